@@ -90,6 +90,7 @@ __sbit __at(0xA8) EINT0;    // External Interrupt 0 Enable - Added
 
 // Power Control
 __sfr __at(0x87) PCON;      // Power control
+#define PCON_IDL 0x01               // Idle: CPU halts, peripherals and interrupts keep running
 
 // UART Control - CORRECTED and expanded
 __sfr __at(0x98) SCON;      // Serial control register
@@ -5,6 +5,7 @@
 #include "types.h"
 #include "H8.h"
 #include "delay.h"
+#include "freq.h"
 
 // AT1846S Register Definitions
 // Core System Registers
@@ -179,6 +180,7 @@ u8 at1846s_reset_chip(void);
 
 // Frequency Control
 void at1846s_set_frequency(u32 freq_khz);
+void at1846s_set_frequency_raw(freq_t freq);
 u8 at1846s_set_band(u8 band);
 u32 at1846s_get_frequency(void);
 
@@ -0,0 +1,69 @@
+#ifndef CHANNEL_H
+#define CHANNEL_H
+
+#include "TA3782F.h"
+#include "types.h"
+#include "eeprom.h"
+#include "crc16.h"
+#include "freq.h"
+
+// EEPROM Layout - Memory channels
+// Fixed 32-byte records, one per EEPROM page, so a channel is always a single
+// sequential read and a single page program. Which slots hold a channel is
+// kept in a separate occupancy bitmap that is loaded into RAM at init, so
+// next/previous searches never touch the bus.
+#define CHANNEL_BASE_ADDR       0x0400  // Record 0 (page aligned), records end at 0x1CFF
+#define CHANNEL_COUNT           200     // Number of channel slots
+#define CHANNEL_RECORD_SIZE     32      // One EEPROM page per record
+#define CHANNEL_BITMAP_ADDR     0x0140  // Occupancy bitmap page
+#define CHANNEL_BITMAP_SIZE     25      // One bit per channel, 0 = occupied (erased = empty)
+#define CHANNEL_NAME_LEN        12      // Characters stored per name
+#define CHANNEL_NONE            0xFF    // No channel / search found nothing
+
+// Packed record layout (byte offsets, multi-byte values big endian)
+#define CHANNEL_OFS_RX_FREQ     0       // RX frequency (freq_t, 3 bytes)
+#define CHANNEL_OFS_TX_FREQ     3       // TX frequency (freq_t, 3 bytes)
+#define CHANNEL_OFS_RX_TONE     6       // RX CTCSS/DCS code (2 bytes)
+#define CHANNEL_OFS_TX_TONE     8       // TX CTCSS/DCS code (2 bytes)
+#define CHANNEL_OFS_POWER       10      // Power level (0-7)
+#define CHANNEL_OFS_BANDWIDTH   11      // 0 = narrow, 1 = wide
+#define CHANNEL_OFS_FLAGS       12      // CHANNEL_FLAG_* bits
+#define CHANNEL_OFS_NAME        16      // Name, NUL padded (12 bytes)
+#define CHANNEL_OFS_CRC         30      // CRC-16 over bytes 0..29 (2 bytes)
+
+// Channel flags
+#define CHANNEL_FLAG_SCAN_SKIP  0x01    // Leave out of memory scan
+#define CHANNEL_FLAG_LOCKOUT    0x02    // TX inhibited
+
+// LRU cache of decoded records in XDATA
+#define CHANNEL_CACHE_LINES     4
+
+// Channel structure (for RAM operations)
+typedef struct {
+    freq_t rx_freq;
+    freq_t tx_freq;
+    u16 rx_tone;
+    u16 tx_tone;
+    u8 power;
+    u8 bandwidth;
+    u8 flags;
+    char name[CHANNEL_NAME_LEN + 1];
+} channel_t;
+
+// Cache statistics for tuning
+extern __xdata u16 channel_cache_hits;
+extern __xdata u16 channel_cache_misses;
+
+// Channel function declarations
+__bit channel_init(void);
+__bit channel_is_used(u8 index);
+u8 channel_count(void);
+const __xdata channel_t* channel_get(u8 index);
+__bit channel_store(u8 index, const __xdata channel_t *channel);
+__bit channel_erase(u8 index);
+u8 channel_write_status(void);
+u8 channel_next(u8 index);
+u8 channel_prev(u8 index);
+void channel_cache_invalidate(void);
+
+#endif // CHANNEL_H
@@ -0,0 +1,53 @@
+#ifndef CLONE_H
+#define CLONE_H
+
+#include "TA3782F.h"
+#include "types.h"
+#include "uart.h"
+#include "eeprom.h"
+#include "crc16.h"
+
+// Binary EEPROM clone/backup protocol on the programming UART.
+//
+// Frame: [SOF][cmd][addr_hi][addr_lo][len_hi][len_lo][payload...][crc_hi][crc_lo]
+// The CRC-16 covers cmd through the end of the payload. Responses use the
+// same framing with cmd | CLONE_RSP_FLAG, or CLONE_RSP_NAK with a one byte
+// error code as payload.
+//
+//   PING  - no payload, answered with an empty ACK
+//   READ  - no payload, len = bytes wanted (1..EEPROM_SIZE); answered with
+//           one frame carrying len bytes streamed from sequential reads
+//   WRITE - payload of exactly one page (addr page aligned, len = 32);
+//           unchanged pages are skipped by a read-compare; others are
+//           queued as one page program and ACKed once it completes
+//   END   - leave clone mode and reload settings and channels from EEPROM;
+//           the ACK follows the reload's status lines on the same UART
+//
+// The UART is polled, so the byte that wakes clone mode from the main loop
+// is usually lost: hosts should repeat PING until it is answered, then
+// send frames back to back.
+#define CLONE_SOF               0xA5
+#define CLONE_CMD_PING          0x50    // 'P'
+#define CLONE_CMD_READ          0x52    // 'R'
+#define CLONE_CMD_WRITE         0x57    // 'W'
+#define CLONE_CMD_END           0x45    // 'E'
+#define CLONE_RSP_FLAG          0x80
+#define CLONE_RSP_NAK           0x15
+
+// NAK error codes
+#define CLONE_ERR_CRC           0x01    // Frame CRC mismatch
+#define CLONE_ERR_RANGE         0x02    // Address/length outside the EEPROM or not page aligned
+#define CLONE_ERR_COMMAND       0x03    // Unknown command
+#define CLONE_ERR_EEPROM        0x04    // I2C transfer failed
+
+// Timeouts in receive polls
+#define CLONE_BYTE_TIMEOUT      20000   // Gap allowed inside a frame
+#define CLONE_IDLE_FRAMES       50      // Byte timeouts without a frame before leaving clone mode
+
+// Watchdog deadline between frames (and between READ pages or drained bytes)
+#define CLONE_FRAME_MS          2000
+
+// Clone function declarations
+void clone_poll(void);
+
+#endif // CLONE_H
@@ -0,0 +1,12 @@
+#ifndef CRC16_H
+#define CRC16_H
+
+#include "types.h"
+
+// CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF, no reflection, no xorout)
+#define CRC16_INIT      0xFFFF
+
+u16 crc16_update(u16 crc, u8 byte);
+u16 crc16(const u8 *data, u8 length);
+
+#endif // CRC16_H
@@ -7,11 +7,56 @@
 #include "delay.h"
 #include "uart.h"
 
+// 24C64: 8 KB organised as 256 pages of 32 bytes
+#define EEPROM_SIZE         0x2000
+#define EEPROM_PAGE_SIZE    32
+
 __bit eeprom_init(const u16 addr);
 void eeprom_start(void);
 __bit eeprom_read(const u16 addr, u8* destination, const u8 size);
 __bit eeprom_write(u16 addr, const __xdata u8 *data, u8 size);
+__bit eeprom_program(u16 addr, const __xdata u8 *data, u8 size);
+__bit eeprom_matches(u16 addr, const __xdata u8 *data, u8 size);
+
+// Non-blocking page program through the I2C queue; poll xfer->status.
+// (struct tag because i2c.h and eeprom.h include each other)
+struct i2c_xfer;
+__bit eeprom_program_submit(__xdata struct i2c_xfer *xfer, u16 addr, const __xdata u8 *data, u8 size);
+
+// Wait for queued programs and the write cycle: all of them, or only those
+// overlapping a range before a direct transaction on it
+__bit eeprom_sync(void);
+__bit eeprom_sync_range(u16 addr, u16 size);
+
+// Sequential read of length bytes (across pages) in one I2C transaction
+__bit eeprom_stream_begin(const u16 addr, const u16 length);
+void eeprom_stream_read(u8* destination, u8 size, __bit last);
+void eeprom_stream_yield(void);
+void eeprom_stream_end(void);
 void eeprom_check_all_addresses(void);
+
+// Read and program transactions started since boot
+extern __xdata u16 eeprom_transactions;
+
+// Byte-addressable access through a small write-back cache of pages.
+// Bytes written here reach the device on eviction or eeprom_cache_flush();
+// until then a direct eeprom_read() of the same page returns the old data.
+#define EEPROM_CACHE_PAGES  4
+
+typedef struct {
+    u16 hits;       // Accesses served from a cached page
+    u16 misses;     // Pages loaded from the device
+    u16 programs;   // Dirty pages written back
+    u16 skipped;    // Writes that matched the cached bytes and changed nothing
+} eeprom_cache_stats_t;
+
+extern __xdata eeprom_cache_stats_t eeprom_cache_stats;
+
+void eeprom_cache_invalidate(void);
+__bit eeprom_cache_read(u16 addr, __xdata u8 *destination, u8 size);
+__bit eeprom_cache_write(u16 addr, const __xdata u8 *data, u8 size);
+__bit eeprom_cache_flush(void);
+__bit eeprom_cache_prefetch(u16 addr, u8 pages);
 // Test functions moved to test_functions_reference.c
 
 
@@ -0,0 +1,39 @@
+#ifndef EVENT_H
+#define EVENT_H
+
+#include "types.h"
+
+// Single-producer/single-consumer event ring between interrupt handlers and
+// the main loop. ISRs post, the scheduler's event task drains. The Bluetooth
+// UART ISR is the only producer: it runs at high priority (uart_bt_init sets
+// its IP bit) and can preempt the tick, so a second producer would need the
+// same priority level or its own ring. Never post from the main loop.
+//
+// The radio firmware has no producer yet: the keypad, the programming UART
+// and the AT1846S are polled, so it leaves the Bluetooth RX interrupt off
+// and registers no event task. test/uart enables the producer and drains
+// the ring itself.
+//
+// The indices are free-running bytes: the producer only writes event_head,
+// the consumer only writes event_tail, each with a single store, so neither
+// side has to mask interrupts. The size must be a power of two no larger
+// than 128 so (head - tail) is the fill level.
+#define EVENT_QUEUE_SIZE        16
+#define EVENT_QUEUE_MASK        (EVENT_QUEUE_SIZE - 1)
+
+// Event types
+#define EVENT_NONE              0
+#define EVENT_UART_RX           1       // arg: UART_PORT_* with new bytes buffered
+
+typedef struct {
+    u8 type;
+    u8 arg;
+} event_t;
+
+// Events lost because the ring was full, for diagnostics
+extern volatile u8 event_dropped;
+
+__bit event_post(u8 type, u8 arg);
+__bit event_get(event_t *event);
+
+#endif // EVENT_H
@@ -13,6 +13,14 @@
 #define MAX_CHARS_PER_STRING DISPLAY_WIDTH / CHAR_WIDTH_IN_PIXELS  
 #define SPACING_BETWEEN_CHARS 12
 
+// RGB565 text colours
+#define FONT_COLOR_BLACK 0x0000
+#define FONT_COLOR_WHITE 0xFFFF
+#define FONT_COLOR_GREY  0x8410     // Dimmed items
+#define FONT_COLOR_RED   0xF800
+#define FONT_COLOR_GREEN 0x07E0
+#define FONT_COLOR_BLUE  0x001F
+
 
 // 16x16 font definitions
 #define FONT_16X16_WIDTH 16
@@ -33,13 +41,22 @@ void render_16x16_number(u8 x, u8 y, u16 number);
 // 16x8 font definitions and functions  
 #define FONT_16X8_WIDTH 16
 #define FONT_16X8_HEIGHT 8
-void render_16x8_char(u8 x, u8 y, char c);
-void render_16x8_string(u8 x, u8 y, const char *str);
+void render_16x8_char_color(u8 x, u8 y, char c, u16 fg, u16 bg);
+void render_16x8_string_color(u8 x, u8 y, const char *str, u16 fg, u16 bg);
 void render_16x8_number(u8 x, u8 y, u16 number);
 
-// 16x8 inverted text functions (for menu highlighting)
-void render_16x8_char_inverted(u8 x, u8 y, char c);
-void render_16x8_string_inverted(u8 x, u8 y, const char *str);
+// White on black, and inverted for menu highlighting
+#define render_16x8_char(x, y, c)               render_16x8_char_color(x, y, c, FONT_COLOR_WHITE, FONT_COLOR_BLACK)
+#define render_16x8_string(x, y, str)           render_16x8_string_color(x, y, str, FONT_COLOR_WHITE, FONT_COLOR_BLACK)
+#define render_16x8_char_inverted(x, y, c)      render_16x8_char_color(x, y, c, FONT_COLOR_BLACK, FONT_COLOR_WHITE)
+#define render_16x8_string_inverted(x, y, str)  render_16x8_string_color(x, y, str, FONT_COLOR_BLACK, FONT_COLOR_WHITE)
+
+// Fixed-pitch cell drawing, used by text fields to repaint single characters
+#define FONT_16X8  0
+#define FONT_16X16 1
+#define FONT_32X32 2
+u8 font_cell_advance(u8 font);
+void font_draw_cells(u8 x, u8 y, const char *cells, u8 count, u8 font, u16 fg, u16 bg);
 
 // Drawing utilities
 void draw_horizontal_line(u8 x1, u8 x2, u8 y);
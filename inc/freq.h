@@ -0,0 +1,38 @@
+#ifndef FREQ_H
+#define FREQ_H
+
+#include "types.h"
+
+// Shared frequency format for settings, channels, the menu and the radio.
+// Frequencies are held in 62.5 Hz units, the native unit of the AT1846S
+// frequency registers (kHz * 16). 520 MHz is 8,320,000 units, so every
+// supported frequency fits in 24 bits on EEPROM, and 6.25 kHz / 12.5 kHz /
+// 25 kHz steps are exact (100 / 200 / 400 units). Converting to and from
+// kHz or the radio registers is a shift; nothing on the tuning path divides.
+typedef u32 freq_t;
+
+#define FREQ_UNIT_SHIFT         4                                   // 16 units per kHz
+#define FREQ_FROM_KHZ(khz)      ((freq_t)(khz) << FREQ_UNIT_SHIFT)
+#define FREQ_TO_KHZ(units)      ((u32)(units) >> FREQ_UNIT_SHIFT)
+#define FREQ_BYTES              3                                   // Packed size on EEPROM
+
+#define FREQ_STEP_6K25          100
+#define FREQ_STEP_12K5          200
+#define FREQ_STEP_25K           400
+
+// Band limits (62.5 Hz units)
+#define FREQ_BAND_MIN           FREQ_FROM_KHZ(136000)
+#define FREQ_BAND_MAX           FREQ_FROM_KHZ(520000)
+
+// Band-relative 6.25 kHz step index, used where values must fit 16 bits (menu)
+#define FREQ_INDEX_STEP         FREQ_STEP_6K25
+#define FREQ_INDEX_MAX          ((u16)((FREQ_BAND_MAX - FREQ_BAND_MIN) / FREQ_INDEX_STEP))  // 61440
+
+// Frequency function declarations
+void freq_pack(__xdata u8 *destination, freq_t freq);
+freq_t freq_unpack(const __xdata u8 *source);
+freq_t freq_from_index(u16 index);
+u16 freq_to_index(freq_t freq);
+void freq_split(freq_t freq, u16 *mhz, u16 *khz);
+
+#endif // FREQ_H
@@ -6,6 +6,7 @@
 #include "battery.h"
 #include "uart.h"
 #include "watchdog.h"
+#include "tick.h"
 
 
 // Function prototypes
@@ -32,4 +32,49 @@ u8 i2c_receive(__bit send_nack);
 __bit i2c_write(const u8 *source, u8 length);
 void i2c_read(u8* destination, u8 length);
 
+// Bus ownership: a transaction runs with interrupts masked so neither a
+// timer-driven queue nor a main loop client can break into it. Calls nest
+// and the interrupt enable state of the outermost caller is restored.
+void i2c_bus_lock(void);
+void i2c_bus_unlock(void);
+__bit i2c_probe(u8 device);
+
+// Transaction queue
+// Clients fill a descriptor, submit it and poll its status. A single
+// executor, i2c_queue_run(), drives descriptors in submission order from
+// the main loop. A device that NACKs its address is still busy (e.g. EEPROM
+// write cycle) and is retried on a later run instead of being polled in a
+// loop, so no client ever blocks on a write cycle.
+#define I2C_XFER_ADDR8          0x01    // Send one memory address byte after the device address
+#define I2C_XFER_ADDR16         0x02    // Send two memory address bytes (24C64)
+
+#define I2C_XFER_IDLE           0       // Never submitted (zero-initialised descriptor)
+#define I2C_XFER_QUEUED         1       // Waiting for the executor
+#define I2C_XFER_DONE           2       // Completed, rx buffer is valid
+#define I2C_XFER_FAILED         3       // NACK during data phase or busy timeout
+
+// How long a device may keep NACKing its address before the descriptor
+// fails. Time based, so a tight drain loop and the 5 ms task agree; the
+// 24C64 write cycle is 5 ms at most.
+#define I2C_XFER_BUSY_TIMEOUT_MS    20
+
+typedef struct i2c_xfer {
+    u8 device;                  // 8-bit write address (e.g. 0xA0)
+    u8 flags;                   // I2C_XFER_ADDR8 / I2C_XFER_ADDR16
+    u16 address;                // Memory address sent after the device address
+    const __xdata u8 *tx;       // Bytes written after the address
+    u8 tx_length;
+    __xdata u8 *rx;             // Bytes read after a repeated start
+    u8 rx_length;
+    volatile u8 status;         // Completion flag, I2C_XFER_*
+    u8 retries;                 // Busy NACKs seen so far, saturating
+    u16 busy_since;             // tick_now() of the first busy NACK
+    __xdata struct i2c_xfer *next;
+} i2c_xfer_t;
+
+void i2c_queue_submit(__xdata i2c_xfer_t *xfer);
+void i2c_queue_run(void);
+__bit i2c_queue_idle(void);
+__bit i2c_queue_overlaps(u8 device, u16 address, u16 length);
+
 #endif
\ No newline at end of file
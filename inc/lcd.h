@@ -16,10 +16,22 @@
 #define SET_BACKLED 0xFF
 
 void lcd_init(void);
+// Data bytes are pipelined: lcd_send_data() returns while the byte is still
+// shifting out. Commands and lcd_fill_run() drain it first; anything else that
+// needs the bus idle (pin changes, sleep) calls lcd_flush().
+void lcd_flush(void);
 void lcd_send_data(u8 data);
 void lcd_send_cmd(u8 command);
+// Window parameters are cached: lcd_set_window() skips CASET or RASET when
+// that range is unchanged. Commands sent with lcd_send_cmd() clear the cache.
 void lcd_set_window(u8 x0, u8 y0, u8 x1, u8 y1);
+void lcd_window_invalidate(void);
 void spi_write_pixel_data(u8 byte_high, u8 byte_low);
+void lcd_fill_run(u16 color565, u16 count);
 void clear_area(u8 x1, u8 y1, u8 x2, u8 y2);
 
+// lcd_set_window() calls, and CASET/RASET commands it left out; both wrap
+extern __xdata u16 lcd_window_sets;
+extern __xdata u16 lcd_window_cmds_skipped;
+
 #endif
\ No newline at end of file
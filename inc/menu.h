@@ -44,6 +44,13 @@
 #define MENU_MIN_CURSOR     0
 #define MENU_MAX_CURSOR     (MENU_COUNT - 1)
 
+// List layout: rows of 16x8 text below the title
+#define MENU_VISIBLE_ITEMS  6
+#define MENU_ROW_X          5
+#define MENU_ROW_Y          20
+#define MENU_ROW_PITCH      14
+#define MENU_ROW_CELLS      12      // Number and name, up to x = 148
+
 // Menu edit modes
 #define MENU_EDIT_NONE      0
 #define MENU_EDIT_CONFIRM   1
@@ -117,6 +124,7 @@ void menu_clear_screen(void);
 
 // New menu system functions
 void menu_render_new_style(void);
+void menu_render_rows(void);
 void menu_render_single_item(u8 item_index, u8 is_selected);
 void menu_render_partial_update(u8 old_cursor, u8 new_cursor);
 void menu_format_value_string(const menu_item_t* item, u16 value, char* buffer);
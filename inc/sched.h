@@ -0,0 +1,59 @@
+#ifndef SCHED_H
+#define SCHED_H
+
+#include "types.h"
+
+// Cooperative run-to-completion scheduler. Each slot is a task that runs when
+// its period elapses or when another task/ISR raises its event flag. Tasks
+// never block; they do a bounded amount of work and return. When nothing is
+// runnable the CPU idles until the next interrupt - at worst the 1 ms tick.
+//
+// Slot numbers double as priorities: when several tasks are runnable the
+// lowest slot goes first, and the scheduler restarts from slot 0 after every
+// task so a key press is never queued behind a full display redraw.
+#define SCHED_TASK_EVENTS       0       // Drains the ISR event ring, see event.h
+#define SCHED_TASK_KEYPAD       1
+#define SCHED_TASK_RSSI         2
+#define SCHED_TASK_UART         3
+#define SCHED_TASK_I2C          4
+#define SCHED_TASK_DISPLAY      5
+#define SCHED_TASK_PERSIST      6
+#define SCHED_TASK_SCAN         7
+#define SCHED_TASKS             8
+
+// Period value for tasks that only run when signalled
+#define SCHED_EVENT_ONLY        0
+
+// Periodic tasks are watchdog clients: each must complete a run within
+// SCHED_WATCHDOG_PERIODS of its period, and never sooner than
+// SCHED_WATCHDOG_MIN_MS so a long redraw can't starve a fast task into a reset
+#define SCHED_WATCHDOG_PERIODS  4
+#define SCHED_WATCHDOG_MIN_MS   2000
+
+typedef void (*sched_task_fn)(void);
+
+// Per-task accounting, readable by diagnostics
+typedef struct {
+    u16 runs;           // Completed runs, wraps
+    u16 max_ms;         // Longest single run seen in ticks
+} sched_stats_t;
+
+extern __xdata sched_stats_t sched_stats[SCHED_TASKS];
+
+// Loop passes that found nothing runnable, and total loop passes
+extern __xdata u32 sched_idle_passes;
+extern __xdata u32 sched_passes;
+
+// Timer counts spent in CPU idle since the last sched_stats_reset()
+extern __xdata u32 sched_idle_counts;
+
+void sched_init(void);
+void sched_add(u8 task, sched_task_fn fn, u16 period_ms);
+void sched_remove(u8 task);
+void sched_signal(u8 task);
+__bit sched_run(void);
+void sched_idle(void);
+u8 sched_idle_percent(void);
+void sched_stats_reset(void);
+
+#endif // SCHED_H
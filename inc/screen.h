@@ -0,0 +1,36 @@
+#ifndef SCREEN_H
+#define SCREEN_H
+
+#include "types.h"
+
+// Normal mode (non-menu) display: VFO label, battery, operating frequency, an
+// RSSI bar and a status block. Each region has a dirty bit set by whatever
+// changes its state; the compositor repaints only dirty regions, and within a
+// text region only the characters that changed, so an idle screen puts no
+// traffic on the LCD bus.
+#define SCREEN_FREQ_CELLS       9       // "MMM.kkkhh": MHz and 10 Hz resolution
+
+// Region dirty bits
+#define SCREEN_REGION_MODE      0x01
+#define SCREEN_REGION_BATTERY   0x02
+#define SCREEN_REGION_FREQ      0x04
+#define SCREEN_REGION_RSSI      0x08
+#define SCREEN_REGION_STATUS    0x10    // Volume and squelch
+#define SCREEN_REGION_STATUS2   0x20    // Power and CTCSS
+#define SCREEN_REGION_ALL       0x3F
+
+// Display task period; bursts of changes inside it are merged into one frame
+#define SCREEN_FRAME_MS         40
+
+// Frames that repainted something, for diagnostics; wraps
+extern __xdata u16 screen_frames;
+
+void screen_init(void);
+void screen_show(void);
+void screen_invalidate(void);
+void screen_mark_dirty(u8 regions);
+void screen_set_rssi(u8 rssi);
+void screen_set_battery(u16 tenths_volt);
+void screen_update(void);
+
+#endif // SCREEN_H
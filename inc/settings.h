@@ -4,28 +4,70 @@
 #include "TA3782F.h"
 #include "types.h"
 #include "eeprom.h"
-
-// EEPROM Layout - Settings storage addresses
-#define SETTINGS_BASE_ADDR      0x0100  // Start settings at offset 256
-#define SETTINGS_MAGIC_ADDR     0x0100  // Magic number to detect valid settings
-#define SETTINGS_VERSION_ADDR   0x0102  // Settings version
-#define SETTINGS_CHECKSUM_ADDR  0x0104  // Simple checksum
-
-// Individual setting addresses (2 bytes each for 16-bit values)
-#define SETTING_FREQUENCY_ADDR  0x0110  // Operating frequency (kHz)
-#define SETTING_VOLUME_ADDR     0x0112  // Volume level (0-15)
-#define SETTING_SQUELCH_ADDR    0x0114  // Squelch level (0-8)
-#define SETTING_POWER_ADDR      0x0116  // Power level (0-7)
-#define SETTING_BACKLIGHT_ADDR  0x0118  // Backlight timeout (seconds)
-#define SETTING_CTCSS_ADDR      0x011A  // CTCSS tone index
+#include "crc16.h"
+#include "freq.h"
+#include "tick.h"
+
+// EEPROM Layout - Settings storage
+// Settings are kept as a snapshot page plus a journal of change records.
+// The snapshot is one 32-byte page (one sequential read / one page program);
+// everyday changes are appended to the journal ring so they never rewrite
+// the snapshot page, and the journal is compacted back into a new snapshot
+// whenever the ring fills up.
+// Two snapshot slots alternate: compaction always programs the inactive
+// slot, so a write cut short by power loss leaves the previous slot intact
+// and boot simply takes the newest slot that passes its CRC.
+#define SETTINGS_BASE_ADDR      0x0100  // Snapshot slot A at offset 256 (page aligned)
+#define SETTINGS_SLOT_B_ADDR    0x0120  // Snapshot slot B, next page
+#define SETTINGS_SLOTS          2       // Slots are adjacent so both read in one transaction
+
+// Packed snapshot image layout (byte offsets inside the page, multi-byte values big endian)
+#define SETTINGS_OFS_MAGIC      0       // Magic number to detect valid settings (2 bytes)
+#define SETTINGS_OFS_VERSION    2       // Image format version (1 byte)
+#define SETTINGS_OFS_SEQUENCE   4       // Journal sequence number covered by this snapshot (2 bytes)
+#define SETTINGS_OFS_FREQUENCY  6       // Operating frequency (freq_t, FREQ_BYTES = 3)
+#define SETTINGS_OFS_VOLUME     9       // Volume level (0-15)
+#define SETTINGS_OFS_SQUELCH    10      // Squelch level (0-8)
+#define SETTINGS_OFS_POWER      11      // Power level (0-7)
+#define SETTINGS_OFS_BACKLIGHT  12      // Backlight timeout (seconds)
+#define SETTINGS_OFS_CTCSS      13      // CTCSS tone index
+#define SETTINGS_OFS_CRC        30      // CRC-16 over bytes 0..29 (2 bytes)
+
+// Settings journal - ring of pages at 0x0200-0x03FF.
+// Page format: [seq_hi, seq_lo] followed by six 5-byte records
+// [field, value_hi, value_mid, value_lo, check]. A record belongs to the
+// sequence number of its page; for each field the newest (seq, slot) wins.
+// Pages whose sequence is not newer than the snapshot are stale.
+#define SETTINGS_JOURNAL_ADDR       0x0200  // First journal page (page aligned)
+#define SETTINGS_JOURNAL_PAGES      16      // Pages in the ring (512 bytes)
+#define SETTINGS_JOURNAL_PAGE_SIZE  32      // One EEPROM page per journal page
+#define SETTINGS_JOURNAL_HDR_SIZE   2       // Page sequence number
+#define SETTINGS_JOURNAL_REC_SIZE   5       // Field id + 24-bit value + check byte
+#define SETTINGS_JOURNAL_RECS       6       // Records per page
+#define SETTINGS_JOURNAL_FREE       0xFF    // Erased field byte marks an empty slot
+#define SETTINGS_JOURNAL_SEQ_FREE   0xFFFF  // Erased header marks an unused page
+
+// Field identifiers used by journal records
+#define SETTINGS_FIELD_FREQUENCY    0
+#define SETTINGS_FIELD_VOLUME       1
+#define SETTINGS_FIELD_SQUELCH      2
+#define SETTINGS_FIELD_POWER        3
+#define SETTINGS_FIELD_BACKLIGHT    4
+#define SETTINGS_FIELD_CTCSS        5
+#define SETTINGS_FIELD_COUNT        6
+#define SETTINGS_FIELD_ALL          0x3F    // Bitmask covering every field
+
+// Deferred persistence: setters only mark fields dirty, and the main loop
+// writes them in one journal append once nothing has changed for a while.
+#define SETTINGS_PERSIST_QUIET_MS   2000    // Quiet period before flushing
 
 // Settings validation constants
 #define SETTINGS_MAGIC          0x4839  // "H8" in ASCII + 1
-#define SETTINGS_VERSION        0x0001  // Current settings version
-#define SETTINGS_SIZE           32      // Total settings block size
+#define SETTINGS_VERSION        0x04    // Current snapshot image version
+#define SETTINGS_SIZE           32      // Total snapshot block size (one EEPROM page)
 
 // Default values
-#define DEFAULT_FREQUENCY       446000  // 446 MHz in kHz
+#define DEFAULT_FREQUENCY       FREQ_FROM_KHZ(446000)  // 446 MHz
 #define DEFAULT_VOLUME          8       // Mid-range volume
 #define DEFAULT_SQUELCH         3       // Moderate squelch
 #define DEFAULT_POWER           4       // Mid power
@@ -33,9 +75,9 @@
 #define DEFAULT_CTCSS           0       // No CTCSS
 
 // Value ranges (for menu system validation)
-#define FREQ_MIN                136000  // 136 MHz minimum
-#define FREQ_MAX                520000  // 520 MHz maximum
-#define FREQ_STEP               5       // 5 kHz steps
+#define FREQ_MIN                FREQ_BAND_MIN   // 136 MHz minimum
+#define FREQ_MAX                FREQ_BAND_MAX   // 520 MHz maximum
+#define FREQ_STEP               FREQ_STEP_6K25  // 6.25 kHz steps
 
 #define VOLUME_MIN              0       // Mute
 #define VOLUME_MAX              15      // Maximum volume
@@ -61,13 +103,13 @@
 typedef struct {
     u16 magic;
     u16 version;
-    u16 frequency;
+    freq_t frequency;
     u16 volume;
     u16 squelch;
     u16 power;
     u16 backlight;
     u16 ctcss;
-    u16 checksum;
+    u16 crc;
 } settings_t;
 
 // Global settings instance
@@ -77,13 +119,20 @@ extern __xdata settings_t current_settings;
 void settings_init(void);
 __bit settings_load(void);
 __bit settings_save(void);
+__bit settings_compact(void);
+void settings_mark_dirty(u8 field);
+void settings_persist_poll(void);
+u8 settings_take_changes(void);
+__bit settings_persist_flush(void);
 void settings_load_defaults(void);
-u16 settings_calculate_checksum(void);
+void settings_pack(__xdata u8 *image, u16 sequence);
+void settings_unpack(const __xdata u8 *image);
+u16 settings_calculate_crc(const __xdata u8 *image);
 __bit settings_validate(void);
 
 // Individual setting accessors
-u16 settings_get_frequency(void);
-void settings_set_frequency(u16 freq_khz);
+freq_t settings_get_frequency(void);
+void settings_set_frequency(freq_t freq);
 u8 settings_get_volume(void);
 void settings_set_volume(u8 volume);
 u8 settings_get_squelch(void);
@@ -96,7 +145,7 @@ u8 settings_get_ctcss(void);
 void settings_set_ctcss(u8 tone_index);
 
 // Settings validation helpers
-__bit settings_is_valid_frequency(u16 freq_khz);
+__bit settings_is_valid_frequency(freq_t freq);
 __bit settings_is_valid_volume(u8 volume);
 __bit settings_is_valid_squelch(u8 squelch);
 __bit settings_is_valid_power(u8 power);
@@ -0,0 +1,30 @@
+#ifndef TEXTFIELD_H
+#define TEXTFIELD_H
+
+#include "types.h"
+#include "font.h"
+
+// Fixed-width text field that remembers what it last put on the LCD. Setting
+// a new value repaints only the character cells that differ, so stepping the
+// frequency by one channel touches one or two digits instead of the line.
+#define TEXTFIELD_MAX_CELLS     (DISPLAY_WIDTH / SPACING_BETWEEN_CHARS)    // 13 cells of 16x8 text
+
+typedef struct {
+    u8 x;
+    u8 y;
+    u8 length;                          // Cells, at most TEXTFIELD_MAX_CELLS
+    u8 font;                            // FONT_16X8 / FONT_16X16 / FONT_32X32
+    u16 fg;
+    u16 bg;
+    char shown[TEXTFIELD_MAX_CELLS];    // Cells on screen, 0 = unknown
+} textfield_t;
+
+// Cells repainted since boot, for diagnostics; wraps
+extern __xdata u16 textfield_cells_drawn;
+
+void textfield_init(textfield_t __xdata *field, u8 x, u8 y, u8 length, u8 font, u16 fg, u16 bg);
+void textfield_invalidate(textfield_t __xdata *field);
+void textfield_set_colors(textfield_t __xdata *field, u16 fg, u16 bg);
+u8 textfield_set(textfield_t __xdata *field, const char *text);
+
+#endif // TEXTFIELD_H
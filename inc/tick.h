@@ -0,0 +1,39 @@
+#ifndef TICK_H
+#define TICK_H
+
+#include "TA3782F.h"
+#include "types.h"
+
+// System tick - Timer0 in mode 1 (16-bit), clocked at Fsys/12 (TMCON bit 3
+// clear), reloaded in the ISR every millisecond. Fsys is not documented for
+// the TA3782F; 12 MHz matches the I2C timing notes and should be calibrated
+// against a scope if the clock turns out different.
+#define TICK_SYSCLK_HZ          12000000UL
+#define TICK_TIMER_HZ           (TICK_SYSCLK_HZ / 12)
+#define TICK_RELOAD             (u16)(65536UL - TICK_TIMER_HZ / 1000)
+#define TICK_RELOAD_H           (u8)(TICK_RELOAD >> 8)
+#define TICK_RELOAD_L           (u8)(TICK_RELOAD & 0xFF)
+#define TICK_COUNTS_PER_MS      (u16)(TICK_TIMER_HZ / 1000)
+
+// Software timers: polled deadlines, so the ISR only advances the clock
+#define TICK_TIMERS             8
+#define TICK_TIMER_NONE         0xFF
+
+// ISR prototype must be visible in the file containing main()
+void tick_isr(void) __interrupt(1);
+
+// Monotonic millisecond clock
+u32 tick_now(void);
+__bit tick_elapsed(u32 since, u32 ms);
+
+// Sub-millisecond clock from the live Timer0 count, in timer counts
+// (microseconds at the assumed 12 MHz). Wraps after ~71 minutes; use for
+// short intervals only.
+u32 tick_now_counts(void);
+
+// One-shot and periodic software timers
+u8 tick_timer_start(u16 ms, __bit periodic);
+__bit tick_timer_expired(u8 timer);
+void tick_timer_stop(u8 timer);
+
+#endif // TICK_H
@@ -4,11 +4,26 @@
 #include "TA3782F.h"
 #include "types.h"
 
-// Reception buffer definitions
+// Reception buffer definitions. Sizes must be powers of two no larger than
+// 128: the rings use free-running byte indices, so (write - read) is the fill
+// level and neither side ever masks interrupts.
 #define UART_RX_BUFFER_SIZE 64
 #define UART_BT_RX_BUFFER_SIZE 64
 
+// Port ids carried by EVENT_UART_RX
+#define UART_PORT_PR 0
+#define UART_PORT_BT 1
+
+// Bytes dropped because a receive ring was full
+extern volatile u8 uart_rx_overflows;
+
+// Bluetooth UART receive ISR (standard 8051 serial vector; uart_bt_init sets
+// its priority bit, uart_bt_rx_enable() unmasks it). Prototype must be
+// visible in the file containing main().
+void uart_bt_isr(void) __interrupt(4);
+
 void uart_bt_init(void);
+void uart_bt_rx_enable(void);
 void uart_pr_init(void);
 void uart_pr_send_byte(const u8 byte);
 void uart_bt_send_byte(const u8 byte);
@@ -17,6 +32,8 @@ u8 uart_pr_data_available(void);
 u8 uart_bt_data_available(void);
 u8 uart_pr_receive_byte(void);
 u8 uart_bt_receive_byte(void);
+u8 uart_pr_try_receive_byte(u8 *data);
+u8 uart_bt_try_receive_byte(u8 *data);
 void uart_pr_check_reception(void);
 void uart_bt_check_reception(void);
 void uart_pr_send_string(const char *str);
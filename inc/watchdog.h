@@ -2,9 +2,43 @@
 #define WATCHDOG_H
 
 #include "TA3782F.h"
+#include "types.h"
+
+// Watchdog supervisor. The hardware dog is fed only from the tick ISR, once
+// every WATCHDOG_FEED_MS, and only while every registered client has checked
+// in within its timeout. watchdog_init() registers the boot client, which
+// main() checks in between init stages and retires once its steady-state
+// loop (the scheduler, or a test firmware's own feed loop) takes over; only
+// with no client registered at all does the tick feed unconditionally.
+// A client that legitimately holds the CPU (clone session) can claim the
+// supervisor so only its own deadline counts until it releases it.
+// A missed deadline stops feeding for good and records the client in
+// watchdog_missed; the ISR does nothing else. watchdog_report(), polled from
+// the main loop, prints the miss on the programming UART if the loop gets
+// back before the hardware dog resets.
+#define WATCHDOG_FEED_MS        32
+#define WATCHDOG_CLIENT_BOOT    8       // Ids 0-7 match scheduler slots
+#define WATCHDOG_CLIENT_CLONE   9
+#define WATCHDOG_CLIENTS        10
+#define WATCHDOG_CLIENT_NONE    0xFF
+
+// Longest allowed gap between boot checkpoints (the boot path has 1.8 s
+// settling delays and chatty diagnostics on a slow UART)
+#define WATCHDOG_BOOT_MS        8000
+
+// Client that missed its deadline, WATCHDOG_CLIENT_NONE while healthy
+extern volatile u8 watchdog_missed;
 
 void watchdog_init(void);
 void watchdog_reset(void);
 void watchdog_config(void);
 
-#endif
\ No newline at end of file
+void watchdog_register(u8 client, u16 timeout_ms);
+void watchdog_unregister(u8 client);
+void watchdog_checkin(u8 client);
+void watchdog_claim(u8 client);
+void watchdog_release(void);
+void watchdog_supervise(void);
+void watchdog_report(void);
+
+#endif
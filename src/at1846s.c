@@ -237,21 +237,24 @@ u8 at1846s_write_register_with_verify(u8 data_low, u8 data_high, u8 reg_addr)
 
 void at1846s_set_frequency(u32 freq_khz)
 {
-    u32 freq_value;
-    u16 freq_high, freq_low;
-    u8 data_high, data_low;
-
     // Check if frequency is in valid range (50 MHz – 1000 MHz)
     if (freq_khz < 50000 || freq_khz > 1000000) {
         return;  // Invalid frequency; do nothing
     }
 
     // Convert frequency in kHz to internal format (f_khz * 16)
-    freq_value = freq_khz * 16;
+    at1846s_set_frequency_raw(FREQ_FROM_KHZ(freq_khz));
+}
+
+// Program a frequency already in register units (62.5 Hz, see freq.h)
+void at1846s_set_frequency_raw(freq_t freq)
+{
+    u16 freq_high, freq_low;
+    u8 data_high, data_low;
 
     // Split into high and low parts
-    freq_high = (u16)((freq_value >> 16) & 0x3FFF);  // upper 14 bits
-    freq_low  = (u16)(freq_value & 0xFFFF);          // lower 16 bits
+    freq_high = (u16)((freq >> 16) & 0x3FFF);  // upper 14 bits
+    freq_low  = (u16)(freq & 0xFFFF);          // lower 16 bits
 
     // Write high frequency register (0x29)
     data_high = (u8)(freq_high >> 8);
@@ -1,6 +1,5 @@
 #include "beep.h"
 #include "delay.h"
-#include "watchdog.h"
 
 // Private variables for beep state
 static u8 beep_initialized = 0;
@@ -9,8 +8,6 @@ static u8 beep_initialized = 0;
 void beep_init(void) {
     // Enable power to TDA2822 amplifier (active high)
     POW2822 = 1;   // Enable power to beep circuit (active high)
-    // Disable interrupts during beep operations
-    EA = 0;
     // Start with beep OFF
     BEEP = 0;      
     // Delay to allow TDA2822 to power up properly
@@ -25,7 +22,6 @@ void beep_init(void) {
 void beep_power_off(void) {
     BEEP = 0;       // Turn off beep signal
     POW2822 = 0;    // Disable power to beep circuit (active high)
-    EA = 1;         // Re-enable interrupts
     beep_initialized = 0;  // Mark as uninitialized
 }
 
@@ -39,8 +35,8 @@ void beep_tone(const u8 duration, const u16 waveLength) {
         beep_init();
     }
     
-    // Disable interrupts during beep generation
-    EA = 0;
+    // Interrupts stay on: the tick must keep the clock running and the
+    // watchdog fed through long tones, and its ISR adds only a few us of jitter
     
     // Simple duration loop
     for (cycles = 0; cycles < duration; cycles++) {
@@ -48,13 +44,10 @@ void beep_tone(const u8 duration, const u16 waveLength) {
         
         // Delay loop for wave length (frequency control)
         for (i = 0; i != waveLength; i++) {
-            watchdog_reset();  // Feed the dog
+            delay_10_cycles();
         }
     }
     
     BEEP = 0;  // Ensure beep is off when done
-    
-    // Re-enable interrupts
-    EA = 1;
 }
 
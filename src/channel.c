@@ -0,0 +1,334 @@
+#include "channel.h"
+#include "uart.h"
+#include "uart_test.h"
+
+// Occupancy bitmap mirrored from EEPROM (bit clear = channel present)
+static __xdata u8 channel_bitmap[CHANNEL_BITMAP_SIZE];
+
+// Record buffer for EEPROM I/O
+static __xdata u8 channel_page[CHANNEL_RECORD_SIZE];
+
+// Record and bitmap programs in flight through the I2C queue. The queue
+// runs them in order, so the record still lands before the bitmap marks it
+// occupied. Each keeps its own copy of the bytes until it completes.
+static __xdata i2c_xfer_t channel_record_xfer;
+static __xdata i2c_xfer_t channel_bitmap_xfer;
+static __xdata u8 channel_record_image[CHANNEL_RECORD_SIZE];
+static __xdata u8 channel_bitmap_image;
+
+// One decoded record in the cache
+typedef struct {
+    u8 index;           // Cached channel, CHANNEL_NONE when the line is free
+    u8 stamp;           // Last access time for LRU replacement
+    channel_t channel;
+} channel_line_t;
+
+static __xdata channel_line_t channel_cache[CHANNEL_CACHE_LINES];
+static __xdata u8 channel_clock;
+
+// Cache statistics: hits are channel_get() calls served from RAM,
+// misses are EEPROM transactions issued to fill the cache
+__xdata u16 channel_cache_hits;
+__xdata u16 channel_cache_misses;
+
+// Serialize a channel into channel_page
+static void channel_pack(const __xdata channel_t *channel) {
+    u16 crc;
+    u8 i;
+
+    for (i = 0; i < CHANNEL_RECORD_SIZE; i++) {
+        channel_page[i] = 0xFF;
+    }
+
+    freq_pack(&channel_page[CHANNEL_OFS_RX_FREQ], channel->rx_freq);
+    freq_pack(&channel_page[CHANNEL_OFS_TX_FREQ], channel->tx_freq);
+    channel_page[CHANNEL_OFS_RX_TONE]     = (u8)(channel->rx_tone >> 8);
+    channel_page[CHANNEL_OFS_RX_TONE + 1] = (u8)channel->rx_tone;
+    channel_page[CHANNEL_OFS_TX_TONE]     = (u8)(channel->tx_tone >> 8);
+    channel_page[CHANNEL_OFS_TX_TONE + 1] = (u8)channel->tx_tone;
+    channel_page[CHANNEL_OFS_POWER]       = channel->power;
+    channel_page[CHANNEL_OFS_BANDWIDTH]   = channel->bandwidth;
+    channel_page[CHANNEL_OFS_FLAGS]       = channel->flags;
+
+    // Name is NUL padded so short names compare equal on rewrite
+    for (i = 0; i < CHANNEL_NAME_LEN && channel->name[i]; i++) {
+        channel_page[CHANNEL_OFS_NAME + i] = (u8)channel->name[i];
+    }
+    for (; i < CHANNEL_NAME_LEN; i++) {
+        channel_page[CHANNEL_OFS_NAME + i] = 0;
+    }
+
+    crc = crc16(channel_page, CHANNEL_OFS_CRC);
+    channel_page[CHANNEL_OFS_CRC]     = (u8)(crc >> 8);
+    channel_page[CHANNEL_OFS_CRC + 1] = (u8)crc;
+}
+
+// Deserialize channel_page; returns 0 if the record fails its CRC
+static __bit channel_unpack(__xdata channel_t *channel) {
+    u16 crc = ((u16)channel_page[CHANNEL_OFS_CRC] << 8) | channel_page[CHANNEL_OFS_CRC + 1];
+    u8 i;
+
+    if (crc != crc16(channel_page, CHANNEL_OFS_CRC)) {
+        return 0;
+    }
+
+    channel->rx_freq   = freq_unpack(&channel_page[CHANNEL_OFS_RX_FREQ]);
+    channel->tx_freq   = freq_unpack(&channel_page[CHANNEL_OFS_TX_FREQ]);
+    channel->rx_tone   = ((u16)channel_page[CHANNEL_OFS_RX_TONE] << 8) | channel_page[CHANNEL_OFS_RX_TONE + 1];
+    channel->tx_tone   = ((u16)channel_page[CHANNEL_OFS_TX_TONE] << 8) | channel_page[CHANNEL_OFS_TX_TONE + 1];
+    channel->power     = channel_page[CHANNEL_OFS_POWER];
+    channel->bandwidth = channel_page[CHANNEL_OFS_BANDWIDTH];
+    channel->flags     = channel_page[CHANNEL_OFS_FLAGS];
+
+    for (i = 0; i < CHANNEL_NAME_LEN; i++) {
+        channel->name[i] = (char)channel_page[CHANNEL_OFS_NAME + i];
+    }
+    channel->name[CHANNEL_NAME_LEN] = 0;
+    return 1;
+}
+
+// Look up a cached channel without touching its LRU stamp
+static __xdata channel_line_t* channel_cache_find(u8 index) {
+    for (u8 i = 0; i < CHANNEL_CACHE_LINES; i++) {
+        if (channel_cache[i].index == index) {
+            return &channel_cache[i];
+        }
+    }
+    return 0;
+}
+
+// Pick a free line, or the least recently used one
+static __xdata channel_line_t* channel_cache_victim(void) {
+    __xdata channel_line_t *victim = &channel_cache[0];
+    u8 oldest = 0;
+
+    for (u8 i = 0; i < CHANNEL_CACHE_LINES; i++) {
+        if (channel_cache[i].index == CHANNEL_NONE) {
+            return &channel_cache[i];
+        }
+        if ((u8)(channel_clock - channel_cache[i].stamp) >= oldest) {
+            oldest = (u8)(channel_clock - channel_cache[i].stamp);
+            victim = &channel_cache[i];
+        }
+    }
+    return victim;
+}
+
+// Read count consecutive records in one sequential transaction and cache
+// the ones that are occupied and not cached yet
+static void channel_fetch(u8 first, u8 count) {
+    __xdata channel_line_t *line;
+    u8 index;
+
+    channel_cache_misses++;
+    if (!eeprom_stream_begin(CHANNEL_BASE_ADDR + (u16)first * CHANNEL_RECORD_SIZE,
+                             (u16)count * CHANNEL_RECORD_SIZE)) {
+        send_uart_message("Channel read failed");
+        return;
+    }
+
+    for (index = first; index < first + count; index++) {
+        eeprom_stream_read(channel_page, CHANNEL_RECORD_SIZE, index == first + count - 1);
+        if (!channel_is_used(index) || channel_cache_find(index)) {
+            continue;
+        }
+        line = channel_cache_victim();
+        line->index = CHANNEL_NONE;
+        if (channel_unpack(&line->channel)) {
+            line->index = index;
+            line->stamp = ++channel_clock;
+        }
+    }
+    eeprom_stream_end();
+}
+
+// Make sure a channel is cached, reading its neighbour in the browsing
+// direction in the same transaction so the next step is served from RAM
+static void channel_prefetch(u8 index, __bit forward) {
+    u8 first = index;
+    u8 count = 1;
+
+    if (channel_cache_find(index)) {
+        return;
+    }
+
+    if (forward) {
+        if (index + 1 < CHANNEL_COUNT && channel_is_used(index + 1) && !channel_cache_find(index + 1)) {
+            count = 2;
+        }
+    } else if (index > 0 && channel_is_used(index - 1) && !channel_cache_find(index - 1)) {
+        first = index - 1;
+        count = 2;
+    }
+
+    channel_fetch(first, count);
+}
+
+void channel_cache_invalidate(void) {
+    for (u8 i = 0; i < CHANNEL_CACHE_LINES; i++) {
+        channel_cache[i].index = CHANNEL_NONE;
+    }
+}
+
+// Load the occupancy bitmap (from the EEPROM cache when boot prefetched it)
+__bit channel_init(void) {
+    channel_cache_invalidate();
+    channel_cache_hits = 0;
+    channel_cache_misses = 0;
+
+    if (!eeprom_cache_read(CHANNEL_BITMAP_ADDR, channel_bitmap, CHANNEL_BITMAP_SIZE)) {
+        send_uart_message("Channel bitmap read failed");
+        for (u8 i = 0; i < CHANNEL_BITMAP_SIZE; i++) {
+            channel_bitmap[i] = 0xFF; // Treat every slot as empty
+        }
+        return 0;
+    }
+    return 1;
+}
+
+__bit channel_is_used(u8 index) {
+    if (index >= CHANNEL_COUNT) {
+        return 0;
+    }
+    return !(channel_bitmap[index >> 3] & (1 << (index & 7)));
+}
+
+u8 channel_count(void) {
+    u8 count = 0;
+    for (u8 index = 0; index < CHANNEL_COUNT; index++) {
+        if (channel_is_used(index)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// Returns the cached record, or 0 if the slot is empty or unreadable
+const __xdata channel_t* channel_get(u8 index) {
+    __xdata channel_line_t *line;
+
+    if (!channel_is_used(index)) {
+        return 0;
+    }
+
+    line = channel_cache_find(index);
+    if (line) {
+        channel_cache_hits++;
+    } else {
+        channel_prefetch(index, 1);
+        line = channel_cache_find(index);
+        if (!line) {
+            return 0;
+        }
+    }
+
+    line->stamp = ++channel_clock;
+    return &line->channel;
+}
+
+// I2C_XFER_QUEUED while a store or erase is still being programmed,
+// I2C_XFER_FAILED if the last one did not reach the EEPROM, else I2C_XFER_DONE
+u8 channel_write_status(void) {
+    if (channel_record_xfer.status == I2C_XFER_QUEUED || channel_bitmap_xfer.status == I2C_XFER_QUEUED) {
+        return I2C_XFER_QUEUED;
+    }
+    if (channel_record_xfer.status == I2C_XFER_FAILED || channel_bitmap_xfer.status == I2C_XFER_FAILED) {
+        return I2C_XFER_FAILED;
+    }
+    return I2C_XFER_DONE;
+}
+
+// Queue the occupancy byte holding index
+static __bit channel_bitmap_submit(u8 index) {
+    u8 byte = index >> 3;
+
+    channel_bitmap_image = channel_bitmap[byte];
+    return eeprom_program_submit(&channel_bitmap_xfer, CHANNEL_BITMAP_ADDR + byte, &channel_bitmap_image, 1);
+}
+
+// Queue a record write (skipped if unchanged), then the bitmap update marking
+// the slot occupied. Returns 0 while the previous store or erase is still
+// being programmed; check channel_write_status() for the outcome.
+__bit channel_store(u8 index, const __xdata channel_t *channel) {
+    __xdata channel_line_t *line;
+    u16 addr = CHANNEL_BASE_ADDR + (u16)index * CHANNEL_RECORD_SIZE;
+
+    if (index >= CHANNEL_COUNT || channel_write_status() == I2C_XFER_QUEUED) {
+        return 0;
+    }
+
+    channel_pack(channel);
+    if (!eeprom_matches(addr, channel_page, CHANNEL_RECORD_SIZE)) {
+        for (u8 i = 0; i < CHANNEL_RECORD_SIZE; i++) {
+            channel_record_image[i] = channel_page[i];
+        }
+        if (!eeprom_program_submit(&channel_record_xfer, addr, channel_record_image, CHANNEL_RECORD_SIZE)) {
+            send_uart_message("Channel write failed");
+            return 0;
+        }
+    }
+
+    // Record first, bitmap second: a power cut never exposes a half-written record
+    if (!channel_is_used(index)) {
+        channel_bitmap[index >> 3] &= (u8)~(1 << (index & 7));
+        channel_bitmap_submit(index);
+    }
+
+    // Keep the cache coherent by decoding what is being written
+    line = channel_cache_find(index);
+    if (!line) {
+        line = channel_cache_victim();
+    }
+    line->index = CHANNEL_NONE;
+    if (channel_unpack(&line->channel)) {
+        line->index = index;
+        line->stamp = ++channel_clock;
+    }
+    return 1;
+}
+
+// Free a slot; only the bitmap byte is queued, the record is left in place
+__bit channel_erase(u8 index) {
+    __xdata channel_line_t *line;
+
+    if (!channel_is_used(index)) {
+        return 1;
+    }
+    if (channel_write_status() == I2C_XFER_QUEUED) {
+        return 0;
+    }
+
+    channel_bitmap[index >> 3] |= (u8)(1 << (index & 7));
+    channel_bitmap_submit(index);
+
+    line = channel_cache_find(index);
+    if (line) {
+        line->index = CHANNEL_NONE;
+    }
+    return 1;
+}
+
+// Next occupied channel after index (wrapping), or CHANNEL_NONE if there is none.
+// Pass CHANNEL_NONE to start from the first slot.
+u8 channel_next(u8 index) {
+    for (u8 step = 0; step < CHANNEL_COUNT; step++) {
+        index = (index >= CHANNEL_COUNT - 1) ? 0 : index + 1;
+        if (channel_is_used(index)) {
+            channel_prefetch(index, 1);
+            return index;
+        }
+    }
+    return CHANNEL_NONE;
+}
+
+// Previous occupied channel before index (wrapping), or CHANNEL_NONE if there is none
+u8 channel_prev(u8 index) {
+    for (u8 step = 0; step < CHANNEL_COUNT; step++) {
+        index = (index == 0 || index >= CHANNEL_COUNT) ? CHANNEL_COUNT - 1 : index - 1;
+        if (channel_is_used(index)) {
+            channel_prefetch(index, 0);
+            return index;
+        }
+    }
+    return CHANNEL_NONE;
+}
@@ -0,0 +1,253 @@
+#include "clone.h"
+#include "watchdog.h"
+#include "settings.h"
+#include "channel.h"
+
+// Page payload / read chunk buffer (must be XDATA for the I2C queue)
+static __xdata u8 clone_buffer[EEPROM_PAGE_SIZE];
+
+// WRITE payload being programmed through the I2C queue. The host waits for
+// the answer before sending more, so clone_buffer stays put until it lands.
+static __xdata i2c_xfer_t clone_xfer;
+static __xdata u16 clone_write_addr;
+static u8 clone_write_pending;
+
+// Address echoed by the END answer
+static __xdata u16 clone_end_addr;
+
+// Running CRC of the frame being sent
+static u16 clone_tx_crc;
+
+// Wait for one byte with a timeout; the UART is polled so keep the loop tight
+static __bit clone_receive(u8 *byte) {
+    u16 timeout = CLONE_BYTE_TIMEOUT;
+    while (timeout--) {
+        uart_pr_check_reception();
+        if (uart_pr_data_available()) {
+            *byte = uart_pr_receive_byte();
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void clone_send(u8 byte) {
+    clone_tx_crc = crc16_update(clone_tx_crc, byte);
+    uart_pr_send_byte(byte);
+}
+
+static void clone_send_header(u8 cmd, u16 addr, u16 length) {
+    uart_pr_send_byte(CLONE_SOF);
+    clone_tx_crc = CRC16_INIT;
+    clone_send(cmd);
+    clone_send((u8)(addr >> 8));
+    clone_send((u8)addr);
+    clone_send((u8)(length >> 8));
+    clone_send((u8)length);
+}
+
+static void clone_send_crc(void) {
+    u16 crc = clone_tx_crc;
+    uart_pr_send_byte((u8)(crc >> 8));
+    uart_pr_send_byte((u8)crc);
+}
+
+static void clone_send_ack(u8 cmd, u16 addr) {
+    clone_send_header(cmd | CLONE_RSP_FLAG, addr, 0);
+    clone_send_crc();
+}
+
+static void clone_send_nak(u16 addr, u8 error) {
+    clone_send_header(CLONE_RSP_NAK, addr, 1);
+    clone_send(error);
+    clone_send_crc();
+}
+
+// Stream a range to the UART. Each page is fetched into clone_buffer by its
+// own short I2C transaction and sent with interrupts enabled, so the tick and
+// the Bluetooth UART keep running through a full backup.
+static void clone_read(u16 addr, u16 length) {
+    u8 chunk;
+    u8 i;
+
+    clone_send_header(CLONE_CMD_READ | CLONE_RSP_FLAG, addr, length);
+
+    while (length) {
+        chunk = (length > EEPROM_PAGE_SIZE) ? EEPROM_PAGE_SIZE : (u8)length;
+
+        if (eeprom_read(addr, clone_buffer, chunk)) {
+            for (i = 0; i < chunk; i++) {
+                clone_send(clone_buffer[i]);
+            }
+        } else {
+            // The frame is already under way: pad it and spoil the CRC so the host retries
+            for (i = 0; i < chunk; i++) {
+                clone_send(0xFF);
+            }
+            clone_tx_crc = ~clone_tx_crc;
+        }
+
+        length -= chunk;
+        addr += chunk;
+        // A full backup is one frame: each page sent counts as progress
+        watchdog_checkin(WATCHDOG_CLIENT_CLONE);
+    }
+
+    clone_send_crc();
+}
+
+// Receive and execute one frame (SOF already consumed).
+// Returns 1 when the host ended the session.
+static __bit clone_frame(void) {
+    u8 header[5];
+    u8 byte;
+    u16 crc = CRC16_INIT;
+    u16 addr;
+    u16 length;
+    u8 i;
+
+    for (i = 0; i < 5; i++) {
+        if (!clone_receive(&header[i])) {
+            return 0; // Truncated frame, drop silently
+        }
+        crc = crc16_update(crc, header[i]);
+    }
+    addr = ((u16)header[1] << 8) | header[2];
+    length = ((u16)header[3] << 8) | header[4];
+
+    // Only WRITE carries a payload, and it is always one page
+    if (header[0] == CLONE_CMD_WRITE) {
+        if (length != EEPROM_PAGE_SIZE) {
+            // Swallow the payload and CRC first, or a 0xA5 inside them would
+            // be taken for the next SOF. A silent host ends it early.
+            for (length += 2; length; length--) {
+                if (!clone_receive(&byte)) {
+                    return 0;
+                }
+                watchdog_checkin(WATCHDOG_CLIENT_CLONE);
+            }
+            clone_send_nak(addr, CLONE_ERR_RANGE);
+            return 0;
+        }
+        for (i = 0; i < EEPROM_PAGE_SIZE; i++) {
+            if (!clone_receive(&clone_buffer[i])) {
+                return 0;
+            }
+            crc = crc16_update(crc, clone_buffer[i]);
+        }
+    }
+
+    if (!clone_receive(&byte)) {
+        return 0;
+    }
+    if (byte != (u8)(crc >> 8) || !clone_receive(&byte) || byte != (u8)crc) {
+        clone_send_nak(addr, CLONE_ERR_CRC);
+        return 0;
+    }
+
+    switch (header[0]) {
+        case CLONE_CMD_PING:
+            clone_send_ack(CLONE_CMD_PING, addr);
+            break;
+
+        case CLONE_CMD_READ:
+            if (length == 0 || addr >= EEPROM_SIZE || length > EEPROM_SIZE - addr) {
+                clone_send_nak(addr, CLONE_ERR_RANGE);
+            } else {
+                clone_read(addr, length);
+            }
+            break;
+
+        case CLONE_CMD_WRITE:
+            if ((addr & (EEPROM_PAGE_SIZE - 1)) || addr >= EEPROM_SIZE) {
+                clone_send_nak(addr, CLONE_ERR_RANGE);
+            } else if (eeprom_matches(addr, clone_buffer, EEPROM_PAGE_SIZE)) {
+                clone_send_ack(CLONE_CMD_WRITE, addr); // Unchanged page, nothing to program
+            } else if (!eeprom_program_submit(&clone_xfer, addr, clone_buffer, EEPROM_PAGE_SIZE)) {
+                clone_send_nak(addr, CLONE_ERR_EEPROM);
+            } else {
+                // Answered by clone_session() once the program completes
+                clone_write_addr = addr;
+                clone_write_pending = 1;
+            }
+            break;
+
+        case CLONE_CMD_END:
+            clone_end_addr = addr; // Answered by clone_session() after the reload
+            return 1;
+
+        default:
+            clone_send_nak(addr, CLONE_ERR_COMMAND);
+            break;
+    }
+    return 0;
+}
+
+// Serve frames back to back until END or the host goes quiet
+static void clone_session(void) {
+    u8 idle = 0;
+    u8 byte;
+    __bit first = 1;
+    __bit ended = 0;
+
+    // The session holds the CPU and keeps every scheduled task from running,
+    // so only its own per-frame deadline is supervised until it ends
+    watchdog_register(WATCHDOG_CLIENT_CLONE, CLONE_FRAME_MS);
+    watchdog_claim(WATCHDOG_CLIENT_CLONE);
+
+    while (idle < CLONE_IDLE_FRAMES) {
+        // Drive the page program queued by the last WRITE, then answer it
+        if (clone_write_pending) {
+            if (clone_xfer.status == I2C_XFER_QUEUED) {
+                i2c_queue_run();
+                continue;
+            }
+            clone_write_pending = 0;
+            if (clone_xfer.status == I2C_XFER_DONE) {
+                clone_send_ack(CLONE_CMD_WRITE, clone_write_addr);
+            } else {
+                clone_send_nak(clone_write_addr, CLONE_ERR_EEPROM);
+            }
+        }
+
+        // Each pass serves one frame or one byte wait; spinning on the queue
+        // above never gets here, so a stuck page program is caught
+        watchdog_checkin(WATCHDOG_CLIENT_CLONE);
+
+        if (first) {
+            byte = CLONE_SOF; // clone_poll() already consumed the wake-up SOF
+            first = 0;
+        } else if (!clone_receive(&byte)) {
+            idle++;
+            continue;
+        }
+        idle = 0;
+        if (byte == CLONE_SOF && clone_frame()) {
+            ended = 1;
+            break;
+        }
+    }
+
+    watchdog_release();
+    watchdog_unregister(WATCHDOG_CLIENT_CLONE);
+
+    // A restore may have replaced everything the RAM copies were built from.
+    // The reload prints status lines on this UART, so END is answered only
+    // afterwards and its ACK is the last thing the host reads.
+    settings_init();
+    channel_init();
+    if (ended) {
+        clone_send_ack(CLONE_CMD_END, clone_end_addr);
+    }
+}
+
+// Call from the main loop: enters clone mode when a frame start arrives
+void clone_poll(void) {
+    uart_pr_check_reception();
+    while (uart_pr_data_available()) {
+        if (uart_pr_receive_byte() == CLONE_SOF) {
+            clone_session();
+            return;
+        }
+    }
+}
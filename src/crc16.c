@@ -0,0 +1,22 @@
+#include "crc16.h"
+
+// Nibble-wide lookup table for polynomial 0x1021 (32 bytes of ROM instead of 512)
+static const __code u16 crc16_nibble_table[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+u16 crc16_update(u16 crc, u8 byte) {
+    // Process high nibble then low nibble, MSB first
+    crc = (crc << 4) ^ crc16_nibble_table[(u8)(crc >> 12) ^ (byte >> 4)];
+    crc = (crc << 4) ^ crc16_nibble_table[(u8)(crc >> 12) ^ (byte & 0x0F)];
+    return crc;
+}
+
+u16 crc16(const u8 *data, u8 length) {
+    u16 crc = CRC16_INIT;
+    while (length--) {
+        crc = crc16_update(crc, *data++);
+    }
+    return crc;
+}
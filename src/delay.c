@@ -3,7 +3,7 @@
 void delay_ms(u8 ms_high, u8 ms_low)
 {
     /* Delay for (ms_high * 256 + ms_low) milliseconds.
-       Uses watchdog-reset and ~1ms calibrated loop. */
+       Uses ~1ms calibrated loop; the tick ISR keeps the watchdog fed. */
 
     while (ms_high != 0 || ms_low != 0) {
         if (ms_low-- == 0) {
@@ -12,7 +12,6 @@ void delay_ms(u8 ms_high, u8 ms_low)
                 ms_high--;
         }
 
-        watchdog_reset();  // Prevent watchdog timeout
         delay_loop();      // ~1ms calibrated delay
     }
 }
@@ -44,13 +43,26 @@ void delay_loop(void)
 void delay_short(u8 cnt)
 {
     /* Short delay loop that runs until cnt is zero.
-       Uses watchdog-reset to prevent timeout. */
+       ~10 machine cycles per count plus loop overhead. */
 
     do {
-        watchdog_reset();  // Prevent watchdog timeout
+        delay_10_cycles();
     } while (cnt-- != 0);
 }
 
+// LCALL + 6 NOPs + RET: ~10 machine cycles
+void delay_10_cycles(void)
+{
+    __asm
+        nop
+        nop
+        nop
+        nop
+        nop
+        nop
+    __endasm;
+}
+
 void delay_15_cycles(void)
 {
     __asm
@@ -1,10 +1,30 @@
 #include "eeprom.h"
+#include "tick.h"
 
 // Forward declarations for functions used in diagnostics
 void send_uart_message(char* message);
 
 __xdata u8 eeprom_buffer[32];
 
+// Write-back page cache
+typedef struct {
+    u16 page;           // Page address of the cached data
+    u8 valid;           // Line holds a page (zero-initialised lines are free)
+    u8 dirty;           // Holds bytes that differ from the EEPROM
+    u8 stamp;           // Last access time for LRU replacement
+    u8 data[EEPROM_PAGE_SIZE];
+} eeprom_cache_line_t;
+
+static __xdata eeprom_cache_line_t eeprom_cache[EEPROM_CACHE_PAGES];
+static __xdata u8 eeprom_cache_clock;
+
+__xdata eeprom_cache_stats_t eeprom_cache_stats;
+
+// Read and program transactions started on the bus (for measuring access patterns)
+__xdata u16 eeprom_transactions;
+
+static void eeprom_cache_update(u16 addr, const __xdata u8 *data, u8 size);
+
 __bit eeprom_init(const u16 addr) {
     // This function initializes the EEPROM by sending the start condition and the device address.
     i2c_delay();
@@ -30,13 +50,52 @@ __bit eeprom_init(const u16 addr) {
     return 1; // Success
 }
 
-__bit eeprom_read(const u16 addr, u8* destination, const u8 size) {
-    // Disable interrupts during I2C operation like original firmware
-    EA = 0;
+// Wait out a write cycle in progress (5 ms at most) so a direct
+// transaction isn't NACKed by a busy device
+static __bit eeprom_wait_ready(void) {
+    u32 start = tick_now();
+
+    while (!i2c_probe(0xA0)) {
+        if (tick_elapsed(start, I2C_XFER_BUSY_TIMEOUT_MS)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Let every queued program land, for callers that rebuild state from the
+// whole device (settings reload) or need their writes on it. Returns 0 if
+// the device stays busy.
+__bit eeprom_sync(void) {
+    while (!i2c_queue_idle()) {
+        i2c_queue_run();
+    }
+    return eeprom_wait_ready();
+}
+
+// Before a direct transaction on [addr, addr + size): only queued programs
+// of that range must land first, so it neither overtakes nor is overtaken
+// by them. Other queued writes stay with task_i2c, and the caller waits at
+// most one write cycle instead of draining the queue.
+__bit eeprom_sync_range(u16 addr, u16 size) {
+    while (i2c_queue_overlaps(0xA0, addr, size)) {
+        i2c_queue_run();
+    }
+    return eeprom_wait_ready();
+}
+
+__bit eeprom_stream_begin(const u16 addr, const u16 length) {
+    if (!eeprom_sync_range(addr, length)) {
+        return 0;
+    }
+    eeprom_transactions++;
+
+    // Hold the bus with interrupts masked like original firmware
+    i2c_bus_lock();
     
     // Step 1: Send address pointer (write mode)
     if (!eeprom_init(addr)) {
-        EA = 1;
+        i2c_bus_unlock();
         return 0; // Failed to set address pointer
     }
     
@@ -44,69 +103,341 @@ __bit eeprom_read(const u16 addr, u8* destination, const u8 size) {
     i2c_start();                 // Repeated START (don't send STOP)
     if (!i2c_send(0xA1)) {       // Device address + read bit
         i2c_stop();
-        EA = 1;
+        i2c_bus_unlock();
         return 0; // Device not responding to read command
     }
-    
-    // Step 3: Read data
-    i2c_read(destination, size);
-    // Step 4: End transaction
+    return 1; // Bus is now streaming bytes from addr onwards
+}
+
+void eeprom_stream_read(u8* destination, u8 size, __bit last) {
+    // The 24C64 auto-increments across page boundaries on reads, so callers can
+    // keep pulling chunks; only the final byte of the transaction gets a NACK.
+    for (u8 i = 0; i < size; i++) {
+        destination[i] = i2c_receive(last && i == (size - 1));
+    }
+}
+
+// Open an interrupt window between chunks of a stream. The master parks SCL
+// low after every byte and the EEPROM simply waits for the next clock, so the
+// transaction survives the tick and UART ISRs running in between.
+void eeprom_stream_yield(void) {
+    i2c_bus_unlock();
+    i2c_bus_lock();
+}
+
+void eeprom_stream_end(void) {
+    // End transaction and release the bus
     i2c_stop();
-    
-    // Re-enable interrupts
-    EA = 1;
+    i2c_bus_unlock();
+}
+
+__bit eeprom_read(const u16 addr, u8* destination, const u8 size) {
+    if (!eeprom_stream_begin(addr, size)) {
+        return 0;
+    }
+    eeprom_stream_read(destination, size, 1);
+    eeprom_stream_end();
     return 1; // Success
 }
 
+__bit eeprom_program(u16 addr, const __xdata u8 *data, u8 size) {
+    // Raw page program without read-compare. The range must not cross a
+    // 32-byte page boundary or the device wraps inside the page.
+    if (size == 0 || (u8)((addr & 31) + size) > 32) {
+        return 0;
+    }
+    if (!eeprom_sync_range(addr, size)) {
+        return 0;
+    }
+
+    eeprom_transactions++;
+    i2c_bus_lock();
+    if (!eeprom_init(addr)) {
+        i2c_bus_unlock();
+        return 0; // Failed to initialize write
+    }
+    if (!i2c_write(data, size)) {
+        i2c_stop();
+        i2c_bus_unlock();
+        return 0; // Failed to write data
+    }
+    i2c_stop();
+    i2c_bus_unlock();
+
+    // Keep any cached copy of this page coherent
+    eeprom_cache_update(addr, data, size);
+
+    // The write cycle (~5ms) runs on without us: the next transaction's
+    // eeprom_sync_range(), or the queue executor, waits for it only if it must
+    return 1;
+}
+
+// Queue a page program. data must stay untouched until xfer->status leaves
+// I2C_XFER_QUEUED; the EEPROM cache sees the new bytes immediately. Same
+// page rule as eeprom_program(). Returns 0 without queueing on a bad range.
+__bit eeprom_program_submit(__xdata i2c_xfer_t *xfer, u16 addr, const __xdata u8 *data, u8 size) {
+    if (size == 0 || (u8)((addr & 31) + size) > 32) {
+        return 0;
+    }
+
+    xfer->device = 0xA0;
+    xfer->flags = I2C_XFER_ADDR16;
+    xfer->address = addr;
+    xfer->tx = data;
+    xfer->tx_length = size;
+    xfer->rx_length = 0;
+
+    eeprom_transactions++;
+    eeprom_cache_update(addr, data, size);
+    i2c_queue_submit(xfer);
+    return 1;
+}
+
+// Returns 1 if the device already holds these bytes (read failures count as
+// a mismatch), so callers can skip the program
+__bit eeprom_matches(u16 addr, const __xdata u8 *data, u8 size) {
+    if (size > sizeof(eeprom_buffer) || !eeprom_read(addr, eeprom_buffer, size)) {
+        return 0;
+    }
+    for (u8 i = 0; i < size; i++) {
+        if (data[i] != eeprom_buffer[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
 __bit eeprom_write(u16 addr, const __xdata u8 *data, u8 size) {
     if ((size & 31) || (addr & 31)) {
         return 0; // must be 32-byte aligned
     }
 
     while (size) {
-        // Read current EEPROM page
-        if (!eeprom_read(addr, eeprom_buffer, 32)) {
-            return 0; // Failed to read current page
+        // Read and compare the current page
+        if (!eeprom_matches(addr, data, 32)) {
+            // Write page
+            if (!eeprom_program(addr, data, 32)) {
+                return 0;
+            }
         }
 
-        // Compare all 32 bytes
-        u8 diff = 0;
-        for (u8 i = 0; i < 32; i++) {
-            if (data[i] != eeprom_buffer[i]) {
-                diff = 1;
-                break;
-            }
+        addr += 32;
+        data += 32;
+        size -= 32;
+    }
+    return 1; // Success
+}
+
+// --- Write-back page cache ---
+// Byte-addressable access to the EEPROM. Writes merge into cached pages and
+// only mark a page dirty when a byte actually changes; dirty pages reach the
+// device on eviction or eeprom_cache_flush(), one page program each.
+
+static __xdata eeprom_cache_line_t* eeprom_cache_find(u16 page) {
+    for (u8 i = 0; i < EEPROM_CACHE_PAGES; i++) {
+        if (eeprom_cache[i].valid && eeprom_cache[i].page == page) {
+            return &eeprom_cache[i];
         }
+    }
+    return 0;
+}
 
-        if (diff) {
-            // Write page
-            if (!eeprom_init(addr)) {
-                return 0; // Failed to initialize write
+static __bit eeprom_cache_writeback(__xdata eeprom_cache_line_t *line) {
+    if (!line->dirty) {
+        return 1;
+    }
+    if (!eeprom_program(line->page, line->data, EEPROM_PAGE_SIZE)) {
+        return 0;
+    }
+    line->dirty = 0;
+    eeprom_cache_stats.programs++;
+    return 1;
+}
+
+// Free a line for a new page: an unused line, else the LRU one (written back first)
+static __xdata eeprom_cache_line_t* eeprom_cache_claim(void) {
+    __xdata eeprom_cache_line_t *line = &eeprom_cache[0];
+    u8 oldest = 0;
+
+    for (u8 i = 0; i < EEPROM_CACHE_PAGES; i++) {
+        if (!eeprom_cache[i].valid) {
+            return &eeprom_cache[i];
+        }
+        if ((u8)(eeprom_cache_clock - eeprom_cache[i].stamp) >= oldest) {
+            oldest = (u8)(eeprom_cache_clock - eeprom_cache[i].stamp);
+            line = &eeprom_cache[i];
+        }
+    }
+
+    if (!eeprom_cache_writeback(line)) {
+        return 0;
+    }
+    line->valid = 0;
+    return line;
+}
+
+// Return the line holding page, loading it on a miss
+static __xdata eeprom_cache_line_t* eeprom_cache_line(u16 page) {
+    __xdata eeprom_cache_line_t *line = eeprom_cache_find(page);
+
+    if (line) {
+        eeprom_cache_stats.hits++;
+    } else {
+        eeprom_cache_stats.misses++;
+        line = eeprom_cache_claim();
+        if (!line || !eeprom_read(page, line->data, EEPROM_PAGE_SIZE)) {
+            return 0;
+        }
+        line->page = page;
+        line->valid = 1;
+        line->dirty = 0;
+    }
+
+    line->stamp = ++eeprom_cache_clock;
+    return line;
+}
+
+// Called by eeprom_program so direct page programs never leave a stale line behind
+static void eeprom_cache_update(u16 addr, const __xdata u8 *data, u8 size) {
+    __xdata eeprom_cache_line_t *line = eeprom_cache_find(addr & ~(EEPROM_PAGE_SIZE - 1));
+    u8 offset = addr & (EEPROM_PAGE_SIZE - 1);
+
+    if (!line || data == &line->data[offset]) {
+        return;
+    }
+    for (u8 i = 0; i < size; i++) {
+        line->data[offset + i] = data[i];
+    }
+}
+
+void eeprom_cache_invalidate(void) {
+    for (u8 i = 0; i < EEPROM_CACHE_PAGES; i++) {
+        eeprom_cache[i].valid = 0;
+        eeprom_cache[i].dirty = 0;
+    }
+}
+
+__bit eeprom_cache_read(u16 addr, __xdata u8 *destination, u8 size) {
+    __xdata eeprom_cache_line_t *line = 0;
+
+    while (size--) {
+        if (!line || (addr & (EEPROM_PAGE_SIZE - 1)) == 0) {
+            line = eeprom_cache_line(addr & ~(EEPROM_PAGE_SIZE - 1));
+            if (!line) {
+                return 0;
             }
-            if (!i2c_write(data, 32)) {
-                i2c_stop();
-                return 0; // Failed to write data
+        }
+        *destination++ = line->data[addr & (EEPROM_PAGE_SIZE - 1)];
+        addr++;
+    }
+    return 1;
+}
+
+__bit eeprom_cache_write(u16 addr, const __xdata u8 *data, u8 size) {
+    __xdata eeprom_cache_line_t *line = 0;
+    __bit changed = 0;
+    u8 offset;
+
+    while (size--) {
+        offset = addr & (EEPROM_PAGE_SIZE - 1);
+        if (!line || offset == 0) {
+            line = eeprom_cache_line(addr & ~(EEPROM_PAGE_SIZE - 1));
+            if (!line) {
+                return 0;
             }
-            i2c_stop();
-
-            // Wait until EEPROM finishes internal write (~5ms)
-            // Safer than fixed delay: poll for ACK
-            while (1) {
-                i2c_start();
-                if (i2c_send(0xA0)) {
-                    i2c_stop();
-                    break;
-                }
-                i2c_stop();
-                i2c_delay();
+        }
+        if (line->data[offset] != *data) {
+            line->data[offset] = *data;
+            line->dirty = 1;
+            changed = 1;
+        }
+        data++;
+        addr++;
+    }
+
+    if (!changed) {
+        eeprom_cache_stats.skipped++; // Same bytes as the device: nothing to program
+    }
+    return 1;
+}
+
+// Load consecutive pages into the cache with a single sequential read, so
+// the boot-time readers that follow are served from RAM. Interrupts run
+// between pages, so the tick keeps feeding the watchdog. Pages already
+// cached keep their RAM copy (it may hold unflushed writes).
+__bit eeprom_cache_prefetch(u16 addr, u8 pages) {
+    __xdata eeprom_cache_line_t *line;
+    u8 fill = 0; // Bit per cache line to fill from the stream
+    u8 p;
+
+    addr &= ~(EEPROM_PAGE_SIZE - 1);
+    if (pages > EEPROM_CACHE_PAGES) {
+        pages = EEPROM_CACHE_PAGES;
+    }
+
+    // Claim every line first: write-backs cannot run inside the read transaction.
+    // Target pages already cached are stamped too, so no later claim in this
+    // loop can take them as the least recently used line.
+    for (p = 0; p < pages; p++) {
+        line = eeprom_cache_find(addr + (u16)p * EEPROM_PAGE_SIZE);
+        if (line) {
+            line->stamp = ++eeprom_cache_clock;
+            continue;
+        }
+        line = eeprom_cache_claim();
+        if (!line) {
+            return 0;
+        }
+        line->page = addr + (u16)p * EEPROM_PAGE_SIZE;
+        line->valid = 1;
+        line->dirty = 0;
+        line->stamp = ++eeprom_cache_clock;
+        fill |= (u8)(1 << (u8)(line - eeprom_cache));
+    }
+    if (!fill) {
+        return 1;
+    }
+
+    eeprom_cache_stats.misses++;
+    if (!eeprom_stream_begin(addr, (u16)pages * EEPROM_PAGE_SIZE)) {
+        for (p = 0; p < EEPROM_CACHE_PAGES; p++) {
+            if (fill & (1 << p)) {
+                eeprom_cache[p].valid = 0;
             }
         }
+        return 0;
+    }
+    for (p = 0; p < pages; p++) {
+        line = eeprom_cache_find(addr + (u16)p * EEPROM_PAGE_SIZE);
+        if (fill & (1 << (u8)(line - eeprom_cache))) {
+            eeprom_stream_read(line->data, EEPROM_PAGE_SIZE, p == pages - 1);
+        } else {
+            eeprom_stream_read(eeprom_buffer, EEPROM_PAGE_SIZE, p == pages - 1); // Keep the RAM copy
+        }
+        eeprom_stream_yield();
+    }
+    eeprom_stream_end();
+    return 1;
+}
 
-        addr += 32;
-        data += 32;
-        size -= 32;
+// Program every dirty page, lowest address first
+__bit eeprom_cache_flush(void) {
+    __xdata eeprom_cache_line_t *next;
+
+    while (1) {
+        next = 0;
+        for (u8 i = 0; i < EEPROM_CACHE_PAGES; i++) {
+            if (eeprom_cache[i].dirty && (!next || eeprom_cache[i].page < next->page)) {
+                next = &eeprom_cache[i];
+            }
+        }
+        if (!next) {
+            return 1;
+        }
+        if (!eeprom_cache_writeback(next)) {
+            return 0;
+        }
     }
-    return 1; // Success
 }
 
 // --- Test functions moved to test_functions_reference.c ---
@@ -0,0 +1,47 @@
+#include "event.h"
+#include "sched.h"
+
+static __xdata event_t event_ring[EVENT_QUEUE_SIZE];
+
+// Free-running indices in internal RAM: one-byte reads and writes are atomic
+static volatile u8 event_head;      // Next slot to fill, written by the producer
+static volatile u8 event_tail;      // Next slot to drain, written by the consumer
+
+volatile u8 event_dropped;
+
+// Producer side, interrupt context only. Returns 0 if the ring was full.
+__bit event_post(u8 type, u8 arg) {
+    u8 head = event_head;
+    event_t __xdata *slot;
+
+    if ((u8)(head - event_tail) >= EVENT_QUEUE_SIZE) {
+        event_dropped++;
+        return 0;
+    }
+
+    slot = &event_ring[head & EVENT_QUEUE_MASK];
+    slot->type = type;
+    slot->arg = arg;
+    // Publish only after the slot is filled
+    event_head = head + 1;
+
+    sched_signal(SCHED_TASK_EVENTS);
+    return 1;
+}
+
+// Consumer side, main loop only. Returns 0 when the ring is empty.
+__bit event_get(event_t *event) {
+    u8 tail = event_tail;
+    event_t __xdata *slot;
+
+    if (tail == event_head) {
+        return 0;
+    }
+
+    slot = &event_ring[tail & EVENT_QUEUE_MASK];
+    event->type = slot->type;
+    event->arg = slot->arg;
+    // Release the slot only after it has been copied out
+    event_tail = tail + 1;
+    return 1;
+}
@@ -17,107 +17,192 @@ __code u8 font_16x16_data[FONT_16X16_CHAR_COUNT][FONT_16X16_BYTES_PER_CHAR] = {
 
 
 
-// Function to render a 16x16 character
-void render_16x16_char(u8 x, u8 y, char c) {
-    if (c < 0x20 || c > 0x7E) return;  // ASCII printable characters only
-    u8 idx = c - 0x20;  // Index starts from space character
+static __code const u16 powers_of_10[] = {10000, 1000, 100, 10, 1};
 
-    // IMPORTANT: explicit code-space pointer
-    const __code u8 *glyph = &font_16x16_data[idx][0];
-
-    lcd_set_window(x, y, x + FONT_16X16_WIDTH - 1, y + FONT_16X16_HEIGHT - 1);
-
-    for (u8 row = 0; row < FONT_16X16_HEIGHT; row++) {
-        // two bytes per row: left 8, right 8
-        u8 b0 = glyph[row * 2 + 0];
-        u8 b1 = glyph[row * 2 + 1];
-        u16 row_data = ((u16)b0 << 8) | b1; // MSB = leftmost pixel
-
-        for (u8 col = 0; col < FONT_16X16_WIDTH; col++) {
-            if (row_data & (0x8000 >> col)) {
-                lcd_send_data(0xFF); // white hi
-                lcd_send_data(0xFF); // white lo
-            } else {
-                lcd_send_data(0x00); // black hi
-                lcd_send_data(0x00); // black lo
-            }
+//=============================================================================
+// TEXT RUN BLITTER
+//=============================================================================
+
+// Glyphs of the run being drawn: at most one per 12-pixel advance
+#define FONT_RUN_MAX_GLYPHS (DISPLAY_WIDTH / SPACING_BETWEEN_CHARS + 1)
+static const __code u8 * __xdata font_run_glyphs[FONT_RUN_MAX_GLYPHS];
+
+// Queue the printable characters of str whose cell starts at or before max_x.
+// Other characters are skipped without advancing, as the old per-character
+// loops did. Returns the number queued.
+static u8 font_run_collect(u8 x, const char *str, const __code u8 *font, u8 bytes_per_char, u8 advance, u8 max_x) {
+    u8 count = 0;
+
+    while (*str && count < FONT_RUN_MAX_GLYPHS) {
+        if (*str >= 0x20 && *str <= 0x7E) {
+            if (x > max_x) break;
+            font_run_glyphs[count++] = font + (u16)(*str - 0x20) * bytes_per_char;
+            x += advance;
         }
+        str++;
     }
+    return count;
 }
 
+// Length of the run of equal bits starting at the MSB, for every byte value.
+// Glyph rows are walked run by run instead of testing a shifted mask per pixel.
+static __code const u8 font_lead_run[256] = {
+    8, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,  // 0x00
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,  // 0x10
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,  // 0x20
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,  // 0x30
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x40
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x50
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x60
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x70
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x80
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x90
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0xA0
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0xB0
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,  // 0xC0
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,  // 0xD0
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,  // 0xE0
+    4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 7, 8   // 0xF0
+};
 
-// Render a string using 16x16 font
-void render_16x16_string(u8 x, u8 y, const char *str) {
-    u8 current_x = x;
-    
-    while (*str && current_x < DISPLAY_WIDTH - FONT_16X16_WIDTH) {
-        if (*str >= 0x20 && *str <= 0x7E) {  // All printable ASCII characters
-            render_16x16_char(current_x, y, *str);
-            current_x += FONT_16X16_WIDTH; // No extra spacing between characters
+// One screen row of the run being drawn, as alternating background and
+// foreground run lengths: even entries are background, odd are foreground.
+// Worst case is a colour change on every pixel.
+static __xdata u8 font_row_runs[DISPLAY_WIDTH + 1];
+static u8 font_row_len;
+
+static void font_row_start(void) {
+    font_row_runs[0] = 0;   // Rows always open with a (possibly empty) background run
+    font_row_len = 1;
+}
+
+// Extend the current run if the colour matches, so runs merge across glyph
+// bytes and glyph boundaries
+static void font_row_append(u8 on, u8 pixels) {
+    if (((font_row_len - 1) & 1) == on) {
+        font_row_runs[font_row_len - 1] += pixels;
+    } else {
+        font_row_runs[font_row_len++] = pixels;
+    }
+}
+
+// Add the top count bits of one glyph byte, each source bit scale pixels
+// wide: scaling is a multiply on the run length, not a per-pixel repeat
+static void font_row_add_byte(u8 bits, u8 count, u8 scale) {
+    u8 run;
+
+    while (count) {
+        run = font_lead_run[bits];
+        if (run > count) {
+            run = count;
         }
-        str++;
+        font_row_append((bits & 0x80) ? 1 : 0, run * scale);
+        bits <<= run;
+        count -= run;
     }
 }
 
+static void font_row_send(u16 fg, u16 bg) {
+    for (u8 i = 0; i < font_row_len; i++) {
+        lcd_fill_run((i & 1) ? fg : bg, font_row_runs[i]);
+    }
+}
 
+// Draw the queued glyphs through one address window, streaming each screen
+// row across the whole run. Glyph rows are 16 source bits (2 bytes); each
+// source row is expanded into runs once and streamed scale times. A glyph
+// wider than the advance (16x8 text at 12 px) is cut to the advance, as the
+// next glyph overwrote those columns anyway; a narrower one is padded with
+// background up to the advance.
+//
+// With clip_last the final glyph is cut or padded to the advance as well, so
+// the window ends exactly at the next cell; text fields use this to redraw
+// cells in the middle of a line without touching their neighbours.
+static void font_run_blit(u8 x, u8 y, u8 count, u8 rows, u8 scale, u8 advance, u8 clip_last, u16 fg, u16 bg) {
+    u8 width = 16 * scale;
+    u8 last = clip_last ? count : count - 1;   // Index of the glyph drawn full width, if any
+    u8 bits = ((advance < width) ? advance : width) / scale;  // Source bits per cut glyph
+    u8 gap = (advance > width) ? advance - width : 0;
+    u8 n;
+
+    lcd_set_window(x, y, clip_last ? x + advance * count - 1 : x + advance * last + width - 1,
+                   y + rows * scale - 1);
+
+    for (u8 row = 0; row < rows; row++) {
+        font_row_start();
+        for (u8 i = 0; i < count; i++) {
+            const __code u8 *glyph = font_run_glyphs[i] + row * 2;  // MSB = leftmost pixel
+
+            n = (i == last) ? 16 : bits;
+            font_row_add_byte(glyph[0], (n > 8) ? 8 : n, scale);
+            if (n > 8) {
+                font_row_add_byte(glyph[1], n - 8, scale);
+            }
+            if (i != last) {
+                font_row_append(0, gap);
+            }
+        }
 
-// Render a number using 16x16 font
-static __code const u16 powers_of_10[] = {10000, 1000, 100, 10, 1};
+        for (u8 repeat = 0; repeat < scale; repeat++) {
+            font_row_send(fg, bg);
+        }
+    }
+}
 
-void render_16x16_number(u8 x, u8 y, u16 number) {
+// Decimal digits of number without leading zeros; buffer needs 6 bytes
+static void font_format_number(char *buffer, u16 number) {
     u8 started = 0;
+
     for (u8 p = 0; p < 5; p++) {
         u8 digit = 0;
         while (number >= powers_of_10[p]) {
             number -= powers_of_10[p];
             digit++;
         }
-        if (digit || started || p == 4) {
-            render_16x16_char(x, y, '0' + digit);
-            x += FONT_16X16_WIDTH + 2;
+        if (digit || started || p == 4) { // Always show at least one digit
+            *buffer++ = '0' + digit;
             started = 1;
         }
     }
+    *buffer = '\0';
 }
 
+//=============================================================================
+// 16x16 FONT FUNCTIONS
+//=============================================================================
 
+// Function to render a 16x16 character
+void render_16x16_char(u8 x, u8 y, char c) {
+    if (c < 0x20 || c > 0x7E) return;  // ASCII printable characters only
 
+    // IMPORTANT: explicit code-space pointer
+    font_run_glyphs[0] = &font_16x16_data[c - 0x20][0];
+    font_run_blit(x, y, 1, FONT_16X16_HEIGHT, 1, FONT_16X16_WIDTH, 0, FONT_COLOR_WHITE, FONT_COLOR_BLACK);
+}
 
 
+// Render a string using 16x16 font, no extra spacing between characters
+void render_16x16_string(u8 x, u8 y, const char *str) {
+    u8 count = font_run_collect(x, str, &font_16x16_data[0][0], FONT_16X16_BYTES_PER_CHAR,
+                                FONT_16X16_WIDTH, DISPLAY_WIDTH - FONT_16X16_WIDTH - 1);
+    if (count) {
+        font_run_blit(x, y, count, FONT_16X16_HEIGHT, 1, FONT_16X16_WIDTH, 0, FONT_COLOR_WHITE, FONT_COLOR_BLACK);
+    }
+}
 
-// Clear a rectangular area of the display
 
-// Demonstration of both fonts
-void dual_font_demo(void) {
-    // Clear the display
-    clear_area(0, 0, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1);
-    
-    // Display using 16x16 font
-    render_16x16_string(5, 5, "16x16 Font");
-    render_16x16_string(10, 25, "Hello World!");
-    render_16x16_string(10, 45, "ABC 123");
-    render_16x16_number(10, 65, 7890);
-    
-    // Wait and show 32x32 font
-    delay_ms(30, 0);  // 3 second delay
-    clear_area(0, 0, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1);
-    
-    // Display using 32x32 font
-    render_32x32_string(5, 5, "32x32");
-    render_32x32_string(5, 45, "BIG");
-    render_32x32_number(5, 85, 42);
-}
 
-// Test individual fonts
-void test_fonts_separate(void) {
-    // Test 16x16 font
-    clear_area(0, 0, 79, 127);
-    render_16x16_string(5, 10, "16x16 Test");
-    render_16x16_string(5, 30, "ABCDEFGH");
-    render_16x16_string(5, 50, "abcd1234");
-    render_16x16_string(5, 70, "!@#$%^&*");
-    render_16x16_number(5, 90, 2024);
-    
+// Render a number using 16x16 font, 2 pixel spacing between digits
+void render_16x16_number(u8 x, u8 y, u16 number) {
+    char buffer[6];
+    u8 count;
+
+    font_format_number(buffer, number);
+    count = font_run_collect(x, buffer, &font_16x16_data[0][0], FONT_16X16_BYTES_PER_CHAR,
+                             FONT_16X16_WIDTH + 2, DISPLAY_WIDTH - FONT_16X16_WIDTH);
+    if (count) {
+        font_run_blit(x, y, count, FONT_16X16_HEIGHT, 1, FONT_16X16_WIDTH + 2, 0, FONT_COLOR_WHITE, FONT_COLOR_BLACK);
+    }
 }
 
 //=============================================================================
@@ -127,76 +212,31 @@ void test_fonts_separate(void) {
 // Function to render a 32x32 character (2x scaled 16x16)
 void render_32x32_char(u8 x, u8 y, char c) {
     if (c < 0x20 || c > 0x7E) return;  // ASCII printable characters only
-    u8 idx = c - 0x20;  // Index starts from space character
 
     // IMPORTANT: explicit code-space pointer
-    const __code u8 *glyph = &font_16x16_data[idx][0];
-
-    lcd_set_window(x, y, x + FONT_32X32_WIDTH - 1, y + FONT_32X32_HEIGHT - 1);
-
-    // Process each row of the 16x16 source font
-    for (u8 row = 0; row < FONT_16X16_HEIGHT; row++) {
-        // Get the two bytes for this row (left 8 bits, right 8 bits)
-        u8 b0 = glyph[row * 2 + 0];
-        u8 b1 = glyph[row * 2 + 1];
-        u16 row_data = ((u16)b0 << 8) | b1; // MSB = leftmost pixel
-        
-        // Render this row twice (2x vertical scaling)
-        for (u8 scale_row = 0; scale_row < 2; scale_row++) {
-            // Process each column of the 16-bit row
-            for (u8 col = 0; col < FONT_16X16_WIDTH; col++) {
-                u8 pixel_on = (row_data & (0x8000 >> col)) ? 1 : 0;
-                
-                // Render this pixel twice (2x horizontal scaling)
-                for (u8 scale_col = 0; scale_col < 2; scale_col++) {
-                    if (pixel_on) {
-                        lcd_send_data(0xFF); // white hi
-                        lcd_send_data(0xFF); // white lo
-                    } else {
-                        lcd_send_data(0x00); // black hi
-                        lcd_send_data(0x00); // black lo
-                    }
-                }
-            }
-        }
-    }
+    font_run_glyphs[0] = &font_16x16_data[c - 0x20][0];
+    font_run_blit(x, y, 1, FONT_16X16_HEIGHT, 2, FONT_32X32_WIDTH, 0, FONT_COLOR_WHITE, FONT_COLOR_BLACK);
 }
 
-// Render a string using 32x32 font
+// Render a string using 32x32 font, no extra spacing between characters
 void render_32x32_string(u8 x, u8 y, const char *str) {
-    u8 current_x = x;
-    
-    while (*str && current_x < DISPLAY_WIDTH - FONT_32X32_WIDTH) {
-        if (*str >= 0x20 && *str <= 0x7E) {  // All printable ASCII characters
-            render_32x32_char(current_x, y, *str);
-            current_x += FONT_32X32_WIDTH; // No extra spacing between characters
-        }
-        str++;
+    u8 count = font_run_collect(x, str, &font_16x16_data[0][0], FONT_16X16_BYTES_PER_CHAR,
+                                FONT_32X32_WIDTH, DISPLAY_WIDTH - FONT_32X32_WIDTH - 1);
+    if (count) {
+        font_run_blit(x, y, count, FONT_16X16_HEIGHT, 2, FONT_32X32_WIDTH, 0, FONT_COLOR_WHITE, FONT_COLOR_BLACK);
     }
 }
 
-// Render a number using 32x32 font
+// Render a number using 32x32 font, 4 pixel spacing between digits
 void render_32x32_number(u8 x, u8 y, u16 number) {
     char buffer[6];
-    u8 i = 0;
-    u16 temp = number;
-
-    if (number == 0) {
-        render_32x32_char(x, y, '0');
-        return;
-    }
+    u8 count;
 
-    // Convert number to string (reverse order)
-    while (temp > 0 && i < 5) {
-        buffer[i++] = '0' + (temp % 10);
-        temp /= 10;
-    }
-
-    // Render digits in correct order
-    u8 current_x = x;
-    while (i > 0 && current_x < DISPLAY_WIDTH - FONT_32X32_WIDTH) {
-        render_32x32_char(current_x, y, buffer[--i]);
-        current_x += FONT_32X32_WIDTH + 4; // Add 4 pixel spacing
+    font_format_number(buffer, number);
+    count = font_run_collect(x, buffer, &font_16x16_data[0][0], FONT_16X16_BYTES_PER_CHAR,
+                             FONT_32X32_WIDTH + 4, DISPLAY_WIDTH - FONT_32X32_WIDTH - 1);
+    if (count) {
+        font_run_blit(x, y, count, FONT_16X16_HEIGHT, 2, FONT_32X32_WIDTH + 4, 0, FONT_COLOR_WHITE, FONT_COLOR_BLACK);
     }
 }
 
@@ -496,109 +536,69 @@ __code u8 font_16x8_data[95][16] = {
     {0x00,0x00,0x00,0x00,0x06,0x20,0x0D,0xB0,0x09,0x90,0x04,0x60,0x00,0x00,0x00,0x00}
 };
 
-// Function definitions for 16x8 font
-void render_16x8_char(u8 x, u8 y, char c) {
+// Function definitions for 16x8 font. The plain and inverted variants are
+// macros over these in font.h.
+void render_16x8_char_color(u8 x, u8 y, char c, u16 fg, u16 bg) {
     if (c < 0x20 || c > 0x7E) return;  // ASCII printable characters only
-    u8 idx = c - 0x20;  // Index starts from space character
 
     // IMPORTANT: explicit code-space pointer
-    const __code u8 *glyph = &font_16x8_data[idx][0];
-
-    lcd_set_window(x, y, x + 15, y + 7);  // 16x8 window
-
-    for (u8 row = 0; row < 8; row++) {
-        // Two bytes per row: left 8, right 8
-        u8 b0 = glyph[row * 2 + 0];
-        u8 b1 = glyph[row * 2 + 1];
-        u16 row_data = ((u16)b0 << 8) | b1; // MSB = leftmost pixel
-
-        for (u8 col = 0; col < 16; col++) {
-            if (row_data & (0x8000 >> col)) {
-                lcd_send_data(0xFF); // white hi
-                lcd_send_data(0xFF); // white lo
-            } else {
-                lcd_send_data(0x00); // black hi
-                lcd_send_data(0x00); // black lo
-            }
-        }
-    }
+    font_run_glyphs[0] = &font_16x8_data[c - 0x20][0];
+    font_run_blit(x, y, 1, FONT_16X8_HEIGHT, 1, FONT_16X8_WIDTH, 0, fg, bg);
 }
 
-void render_16x8_string(u8 x, u8 y, const char *str) {
-    u8 current_x = x;
-    
-    while (*str) {
-        if (current_x + 16 > DISPLAY_WIDTH) break; // Stop if next char would go off screen
-        if (*str >= 0x20 && *str <= 0x7E) {  // All printable ASCII characters
-            render_16x8_char(current_x, y, *str);
-            current_x += 12; // 12 pixel spacing
-        }
-        str++;
+// 12 pixel spacing; stops before a character that would go off screen
+void render_16x8_string_color(u8 x, u8 y, const char *str, u16 fg, u16 bg) {
+    u8 count = font_run_collect(x, str, &font_16x8_data[0][0], 16,
+                                SPACING_BETWEEN_CHARS, DISPLAY_WIDTH - FONT_16X8_WIDTH);
+    if (count) {
+        font_run_blit(x, y, count, FONT_16X8_HEIGHT, 1, SPACING_BETWEEN_CHARS, 0, fg, bg);
     }
 }
 
 void render_16x8_number(u8 x, u8 y, u16 number) {
-    u8 started = 0;
-    u8 current_x = x;
-    
-    for (u8 p = 0; p < 5; p++) {
-        u8 digit = 0;
-        while (number >= powers_of_10[p]) {
-            number -= powers_of_10[p];
-            digit++;
-        }
-        if (digit || started || p == 4) { // Show digit if non-zero, already started, or last digit (always show at least one digit)
-            if (current_x + 16 > DISPLAY_WIDTH) break; // Stop if next char would go off screen
-            render_16x8_char(current_x, y, '0' + digit);
-            current_x += 12; // 12 pixel spacing for numbers too
-            started = 1;
-        }
-    }
+    char buffer[6];
+
+    font_format_number(buffer, number);
+    render_16x8_string(x, y, buffer);
 }
 
 //=============================================================================
-// 16x8 INVERTED TEXT FUNCTIONS (for menu highlighting)
+// TEXT CELLS
 //=============================================================================
 
-void render_16x8_char_inverted(u8 x, u8 y, char c) {
-    if (c < 0x20 || c > 0x7E) return;  // ASCII printable characters only
-    u8 idx = c - 0x20;  // Index starts from space character
+// Geometry of each FONT_* id for cell drawing
+typedef struct {
+    const __code u8 *data;
+    u8 bytes_per_char;
+    u8 rows;            // Source rows per glyph
+    u8 scale;
+    u8 advance;         // Cell width in pixels
+} font_cell_t;
+
+static __code const font_cell_t font_cells[] = {
+    { &font_16x8_data[0][0],  16,                        FONT_16X8_HEIGHT,  1, SPACING_BETWEEN_CHARS },
+    { &font_16x16_data[0][0], FONT_16X16_BYTES_PER_CHAR, FONT_16X16_HEIGHT, 1, FONT_16X16_WIDTH },
+    { &font_16x16_data[0][0], FONT_16X16_BYTES_PER_CHAR, FONT_16X16_HEIGHT, 2, FONT_32X32_WIDTH },
+};
 
-    // IMPORTANT: explicit code-space pointer
-    const __code u8 *glyph = &font_16x8_data[idx][0];
-
-    lcd_set_window(x, y, x + 15, y + 7);  // 16x8 window
-
-    for (u8 row = 0; row < 8; row++) {
-        // Two bytes per row: left 8, right 8
-        u8 b0 = glyph[row * 2 + 0];
-        u8 b1 = glyph[row * 2 + 1];
-        u16 row_data = ((u16)b0 << 8) | b1; // MSB = leftmost pixel
-
-        for (u8 col = 0; col < 16; col++) {
-            if (row_data & (0x8000 >> col)) {
-                // Inverted: black on white background
-                lcd_send_data(0x00); // black hi
-                lcd_send_data(0x00); // black lo
-            } else {
-                // Inverted: white background
-                lcd_send_data(0xFF); // white hi
-                lcd_send_data(0xFF); // white lo
-            }
-        }
-    }
+u8 font_cell_advance(u8 font) {
+    return font_cells[font].advance;
 }
 
-void render_16x8_string_inverted(u8 x, u8 y, const char *str) {
-    u8 current_x = x;
-    
-    while (*str) {
-        if (current_x + 16 > DISPLAY_WIDTH) break; // Stop if next char would go off screen
-        if (*str >= 0x20 && *str <= 0x7E) {  // All printable ASCII characters
-            render_16x8_char_inverted(current_x, y, *str);
-            current_x += 12; // 12 pixel spacing
-        }
-        str++;
+// Draw count printable characters into consecutive cells starting at x. Every
+// cell, the last included, is exactly one advance wide, so a span in the
+// middle of a line leaves the cells on either side untouched.
+void font_draw_cells(u8 x, u8 y, const char *cells, u8 count, u8 font, u16 fg, u16 bg) {
+    const font_cell_t __code *f = &font_cells[font];
+
+    if (count > FONT_RUN_MAX_GLYPHS) {
+        count = FONT_RUN_MAX_GLYPHS;
+    }
+    for (u8 i = 0; i < count; i++) {
+        font_run_glyphs[i] = f->data + (u16)GET_CHAR_INDEX(cells[i]) * f->bytes_per_char;
+    }
+    if (count) {
+        font_run_blit(x, y, count, f->rows, f->scale, f->advance, 1, fg, bg);
     }
 }
 
@@ -614,9 +614,5 @@ void draw_horizontal_line(u8 x1, u8 x2, u8 y) {
     }
     
     lcd_set_window(x1, y, x2, y);
-    
-    for (u8 x = x1; x <= x2; x++) {
-        lcd_send_data(0xFF); // white hi
-        lcd_send_data(0xFF); // white lo
-    }
+    lcd_fill_run(0xFFFF, x2 - x1 + 1);  // White
 }
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include "freq.h"
+
+// Store a frequency as 3 big endian bytes
+void freq_pack(__xdata u8 *destination, freq_t freq) {
+    destination[0] = (u8)(freq >> 16);
+    destination[1] = (u8)(freq >> 8);
+    destination[2] = (u8)freq;
+}
+
+freq_t freq_unpack(const __xdata u8 *source) {
+    return ((freq_t)source[0] << 16) | ((u16)source[1] << 8) | source[2];
+}
+
+// Band-relative 6.25 kHz index to frequency (multiply only)
+freq_t freq_from_index(u16 index) {
+    return FREQ_BAND_MIN + (freq_t)index * FREQ_INDEX_STEP;
+}
+
+// Frequency to the nearest index at or below it, clamped to the band.
+// Divides, so keep it off the tuning path (menu entry / display only).
+u16 freq_to_index(freq_t freq) {
+    if (freq <= FREQ_BAND_MIN) {
+        return 0;
+    }
+    if (freq >= FREQ_BAND_MAX) {
+        return FREQ_INDEX_MAX;
+    }
+    return (u16)((freq - FREQ_BAND_MIN) / FREQ_INDEX_STEP);
+}
+
+// Split into whole MHz and kHz for display (sub-kHz part is truncated)
+void freq_split(freq_t freq, u16 *mhz, u16 *khz) {
+    u32 total_khz = FREQ_TO_KHZ(freq);
+    *mhz = (u16)(total_khz / 1000);
+    *khz = (u16)(total_khz - (u32)*mhz * 1000);
+}
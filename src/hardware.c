@@ -42,16 +42,16 @@ void timer_init(void)
  {
      /* Timer0 Initialization:
         - Mode 1 (16-bit timer mode)
-        - Clears Timer0 registers
-        - Enables Timer0 interrupt
+        - Loads the 1 ms system tick reload value (see tick.h)
+        - Enables Timer0 interrupt (tick_isr)
         - Starts Timer0
      */
  
-     TMCON &= ~0x08;     // Clear Timer0 control bit if needed (bit 3)
+     TMCON &= ~0x08;     // Clear Timer0 control bit if needed (bit 3): Timer0 clock = Fsys/12
      TMOD  |= 0x01;      // Set Timer0 to mode 1 (16-bit) TL0 and TH0 are all valid
  
-     TH0 = 0x00;         // High byte of Timer0 start value
-     TL0 = 0x00;         // Low byte of Timer0 start value
+     TH0 = TICK_RELOAD_H; // High byte of Timer0 start value
+     TL0 = TICK_RELOAD_L; // Low byte of Timer0 start value
  
      TR0 = 0;            // Stop Timer0
      ET0 = 1;            // Enable Timer0 interrupt
@@ -1,5 +1,6 @@
 
 #include "i2c.h"
+#include "tick.h"
 
 #define __nop() __asm nop __endasm
 
@@ -122,6 +123,155 @@ void i2c_read(u8* destination, u8 length) {
     }
 }
 
+// --- Bus Ownership ---
+
+static u8 i2c_lock_depth;
+static __bit i2c_saved_ea;
+
+void i2c_bus_lock(void) {
+    __bit ea = EA;
+    EA = 0;
+    if (i2c_lock_depth++ == 0) {
+        i2c_saved_ea = ea;
+    }
+}
+
+void i2c_bus_unlock(void) {
+    if (--i2c_lock_depth == 0) {
+        EA = i2c_saved_ea;
+    }
+}
+
+// Address-only transaction: returns 1 if the device ACKs (present and not busy)
+__bit i2c_probe(u8 device) {
+    __bit ack;
+
+    i2c_bus_lock();
+    i2c_start();
+    ack = i2c_send(device);
+    i2c_stop();
+    i2c_bus_unlock();
+    return ack;
+}
+
+// --- Transaction Queue ---
+
+static __xdata i2c_xfer_t *i2c_queue_head;
+static __xdata i2c_xfer_t *i2c_queue_tail;
+static __bit i2c_queue_running;
+
+void i2c_queue_submit(__xdata i2c_xfer_t *xfer) {
+    xfer->status = I2C_XFER_QUEUED;
+    xfer->retries = 0;
+    xfer->next = 0;
+
+    i2c_bus_lock();
+    if (i2c_queue_tail) {
+        i2c_queue_tail->next = xfer;
+    } else {
+        i2c_queue_head = xfer;
+    }
+    i2c_queue_tail = xfer;
+    i2c_bus_unlock();
+}
+
+__bit i2c_queue_idle(void) {
+    return i2c_queue_head == 0;
+}
+
+// 1 if a descriptor still waiting in the queue touches [address, address + length)
+// on device, so a direct transaction on that range must let it go first
+__bit i2c_queue_overlaps(u8 device, u16 address, u16 length) {
+    __xdata i2c_xfer_t *xfer;
+    __bit found = 0;
+
+    i2c_bus_lock();
+    for (xfer = i2c_queue_head; xfer; xfer = xfer->next) {
+        if (xfer->device == device &&
+            xfer->address < address + length &&
+            address < xfer->address + xfer->tx_length + xfer->rx_length) {
+            found = 1;
+            break;
+        }
+    }
+    i2c_bus_unlock();
+    return found;
+}
+
+// Run one descriptor as a single bus transaction.
+// Returns 0 if the device NACKed its address (busy), 1 once the descriptor is finished.
+static __bit i2c_queue_execute(__xdata i2c_xfer_t *xfer) {
+    __bit ok = 1;
+
+    i2c_bus_lock();
+    i2c_start();
+    if (!i2c_send(xfer->device)) {
+        i2c_stop();
+        i2c_bus_unlock();
+        return 0;
+    }
+
+    if (xfer->flags & I2C_XFER_ADDR16) {
+        ok = i2c_send((u8)(xfer->address >> 8));
+    }
+    if (ok && (xfer->flags & (I2C_XFER_ADDR8 | I2C_XFER_ADDR16))) {
+        ok = i2c_send((u8)xfer->address);
+    }
+    if (ok && xfer->tx_length) {
+        ok = i2c_write(xfer->tx, xfer->tx_length);
+    }
+    if (ok && xfer->rx_length) {
+        i2c_start(); // Repeated START
+        ok = i2c_send(xfer->device | 0x01);
+        if (ok) {
+            i2c_read(xfer->rx, xfer->rx_length);
+        }
+    }
+    i2c_stop();
+    i2c_bus_unlock();
+
+    xfer->status = ok ? I2C_XFER_DONE : I2C_XFER_FAILED;
+    return 1;
+}
+
+// Executor: advances the queue by at most one transaction per call
+void i2c_queue_run(void) {
+    __xdata i2c_xfer_t *xfer;
+
+    // A run must not re-enter one already in progress
+    i2c_bus_lock();
+    if (i2c_queue_running || !i2c_queue_head) {
+        i2c_bus_unlock();
+        return;
+    }
+    i2c_queue_running = 1;
+    xfer = i2c_queue_head;
+    i2c_bus_unlock();
+
+    if (!i2c_queue_execute(xfer)) {
+        // Still busy (e.g. EEPROM write cycle): try again on the next run
+        if (xfer->retries == 0) {
+            xfer->busy_since = (u16)tick_now();
+        }
+        if (xfer->retries != 0xFF) {
+            xfer->retries++;
+        }
+        if ((u16)((u16)tick_now() - xfer->busy_since) < I2C_XFER_BUSY_TIMEOUT_MS) {
+            i2c_queue_running = 0;
+            return;
+        }
+        xfer->status = I2C_XFER_FAILED;
+    }
+
+    i2c_bus_lock();
+    i2c_queue_head = xfer->next;
+    if (!i2c_queue_head) {
+        i2c_queue_tail = 0;
+    }
+    i2c_queue_running = 0;
+    i2c_bus_unlock();
+}
+
 // --- Low-Level Pin and Delay Control ---
 
 void i2c_delay(void) {
@@ -38,6 +38,7 @@ void lcd_init(void)
 {
     const __code u8 *p = lcd_init_data;
     u8 i = 0;
+    LCD_CD = 0;     // Chip select; stays asserted from here on
     while(1)
     {
         u8 cmd = *p++;
@@ -68,22 +69,57 @@ void lcd_init(void)
     }
 }
 
+// Set while the last byte written to EXBH may still be shifting out
+static __bit lcd_tx_pending;
+
+// Wait until the shifter has finished the last byte
+void lcd_flush(void) {
+    if (lcd_tx_pending) {
+        while (!EXBL);
+        lcd_tx_pending = 0;
+    }
+}
+
+// Last CASET/RASET parameters sent. The controller keeps its address window
+// until told otherwise, so lcd_set_window() only resends the half that
+// changed: glyphs along a text row share the rows, stacked rows share the
+// columns. Any command sent through lcd_send_cmd() drops the cache, as it may
+// have moved the window or changed how the controller maps it.
+static __xdata u8 lcd_win_x0, lcd_win_x1, lcd_win_y0, lcd_win_y1;
+static __bit lcd_win_valid;
+
+__xdata u16 lcd_window_sets;
+__xdata u16 lcd_window_cmds_skipped;
+
+// LCD_CD (chip select) is asserted once by lcd_init() and never released, and
+// LCD_DAO rests high (data) between commands, so data bytes touch neither pin
 void lcd_send_data(u8 data) {
-    LCD_CD = 0;      // Keep in data mode (D/C = 1 after cmd)
+    // Wait for the previous byte rather than this one, so the caller works
+    // out the next pixel while this byte shifts out
+    while (lcd_tx_pending && !EXBL);
     EXBL = 0;
     EXBH = data;     // Send data byte
-    // Wait for transmission complete
-    while (!EXBL);
+    lcd_tx_pending = 1;
 }
 
-void lcd_send_cmd(u8 command) {
-    LCD_DAO = 0;     // Set data direction
-    LCD_CD = 0;      // Set to command mode (D/C = 0)
+static void lcd_write_cmd(u8 command) {
+    lcd_flush();     // D/C must not change under a data byte
+    LCD_DAO = 0;     // Command (D/C = 0)
     EXBL = 0;
     EXBH = command;  // Send command byte
     // Wait for transmission complete
     while (!EXBL);
-    LCD_DAO = 1;
+    LCD_DAO = 1;     // Back to data
+}
+
+void lcd_send_cmd(u8 command) {
+    lcd_window_invalidate();
+    lcd_write_cmd(command);
+}
+
+// Force the next lcd_set_window() to send both CASET and RASET
+void lcd_window_invalidate(void) {
+    lcd_win_valid = 0;
 }
 
 void spi_write_pixel_data(u8 byte_high,u8 byte_low)
@@ -95,31 +131,87 @@ void spi_write_pixel_data(u8 byte_high,u8 byte_low)
 
 void lcd_set_window(u8 x0, u8 y0, u8 x1, u8 y1)
 {
+    lcd_window_sets++;
+
     // CASET (0x2A) - Column Address Set
-    lcd_send_cmd(0x2A);
-    lcd_send_data(0x00);    // XS[15:8] - high byte (always 0 for this display)
-    lcd_send_data(x0);      // XS[7:0] - start column
-    lcd_send_data(0x00);    // XE[15:8] - high byte (always 0)
-    lcd_send_data(x1);      // XE[7:0] - end column
+    if (!lcd_win_valid || x0 != lcd_win_x0 || x1 != lcd_win_x1) {
+        lcd_write_cmd(0x2A);
+        lcd_send_data(0x00);    // XS[15:8] - high byte (always 0 for this display)
+        lcd_send_data(x0);      // XS[7:0] - start column
+        lcd_send_data(0x00);    // XE[15:8] - high byte (always 0)
+        lcd_send_data(x1);      // XE[7:0] - end column
+        lcd_win_x0 = x0;
+        lcd_win_x1 = x1;
+    } else {
+        lcd_window_cmds_skipped++;
+    }
     
     // RASET (0x2B) - Row Address Set
-    lcd_send_cmd(0x2B);  
-    lcd_send_data(0x00);    // YS[15:8] - high byte (always 0)
-    lcd_send_data(y0);      // YS[7:0] - start row
-    lcd_send_data(0x00);    // YE[15:8] - high byte (always 0)
-    lcd_send_data(y1);      // YE[7:0] - end row
+    if (!lcd_win_valid || y0 != lcd_win_y0 || y1 != lcd_win_y1) {
+        lcd_write_cmd(0x2B);
+        lcd_send_data(0x00);    // YS[15:8] - high byte (always 0)
+        lcd_send_data(y0);      // YS[7:0] - start row
+        lcd_send_data(0x00);    // YE[15:8] - high byte (always 0)
+        lcd_send_data(y1);      // YE[7:0] - end row
+        lcd_win_y0 = y0;
+        lcd_win_y1 = y1;
+    } else {
+        lcd_window_cmds_skipped++;
+    }
+    lcd_win_valid = 1;
+
+    // Always sent: RAMWR restarts writing at the window origin
+    lcd_write_cmd(0x2C); // Memory write command
+}
 
-    lcd_send_cmd(0x2C); // Memory write command
+// Operands for the lcd_fill_run() loop, in direct RAM so the asm can use
+// them without touching the registers SDCC may be holding
+static __data u8 lcd_run_hi;
+static __data u8 lcd_run_lo;
+static __data u8 lcd_run_count_lo;
+static __data u8 lcd_run_count_hi;
+
+// Stream count pixels of one RGB565 colour into the current window. Same
+// handshake as lcd_send_data() (clear EXBL, load EXBH, wait for EXBL), but
+// CS stays asserted for the whole run and the next byte is loaded the moment
+// the shifter reports ready, with no call/return or CS write per byte. Returns
+// once the last byte is out, so nothing is left pending.
+void lcd_fill_run(u16 color565, u16 count) {
+    if (count == 0) {
+        return;
+    }
+
+    lcd_run_hi = (u8)(color565 >> 8);
+    lcd_run_lo = (u8)color565;
+    // Two nested DJNZ counters: the high byte takes one extra pass unless
+    // the low byte starts at 0 (which DJNZ treats as 256)
+    lcd_run_count_lo = (u8)count;
+    lcd_run_count_hi = (u8)(count >> 8) + ((u8)count != 0);
+
+    lcd_flush();     // The loop's first EXBL clear would cut a pending byte short
+    // Colour bytes live in R2/R3 for the loop; nothing after it needs them
+    __asm
+        mov     r2,_lcd_run_hi
+        mov     r3,_lcd_run_lo
+00001$:
+        mov     _EXBL,#0x00
+        mov     _EXBH,r2
+00002$:
+        mov     a,_EXBL
+        jz      00002$
+        mov     _EXBL,#0x00
+        mov     _EXBH,r3
+00003$:
+        mov     a,_EXBL
+        jz      00003$
+        djnz    _lcd_run_count_lo,00001$
+        djnz    _lcd_run_count_hi,00001$
+    __endasm;
 }
 
 void clear_area(u8 x1, u8 y1, u8 x2, u8 y2) {
     lcd_set_window(x1, y1, x2, y2);
-    
-    u16 pixel_count = (u16)(x2 - x1 + 1) * (y2 - y1 + 1);
-    for (u16 i = 0; i < pixel_count; i++) {
-        lcd_send_data(0x00);  // Black background
-        lcd_send_data(0x00);
-    }
+    lcd_fill_run(0x0000, (u16)(x2 - x1 + 1) * (y2 - y1 + 1));  // Black background
 }
 
 
@@ -22,6 +22,132 @@
 #include "uart_test.h"
 #include "menu.h"
 #include "settings.h"
+#include "channel.h"
+#include "clone.h"
+#include "tick.h"
+#include "sched.h"
+#include "screen.h"
+
+// --- scheduler tasks ---
+#define KEYPAD_SCAN_MS          10
+#define KEY_REPEAT_DELAY_MS     500     // Hold time before a key auto-repeats
+#define KEY_REPEAT_RATE_MS      100
+#define SENSE_RSSI_MS           200
+#define SENSE_BATTERY_EVERY     5       // RSSI periods per battery sample
+
+// Move the VFO one channel step, stopping at the band edges, and retune the
+// AT1846S so the radio follows the readout
+static void step_frequency(u8 up) {
+    freq_t freq = settings_get_frequency();
+
+    if (up) {
+        if (freq + FREQ_STEP > FREQ_MAX) {
+            return;
+        }
+        freq += FREQ_STEP;
+    } else {
+        if (freq < FREQ_MIN + FREQ_STEP) {
+            return;
+        }
+        freq -= FREQ_STEP;
+    }
+    settings_set_frequency(freq);
+    if (settings_get_frequency() == freq) {
+        at1846s_set_frequency_raw(freq);
+    }
+}
+
+// Scanning faster than the old 50 ms loop means a held key must be
+// edge-detected, with its own repeat timing, instead of firing every scan
+static void task_keypad(void) {
+    static u8 last_key = 0;
+    static u32 repeat_at;
+    u8 current_key = keypad_scan();
+
+    if (current_key == 0) {
+        last_key = 0;
+        return;
+    }
+    if (current_key != last_key) {
+        last_key = current_key;
+        repeat_at = tick_now() + KEY_REPEAT_DELAY_MS;
+    } else if ((i32)(tick_now() - repeat_at) >= 0) {
+        repeat_at += KEY_REPEAT_RATE_MS;
+    } else {
+        return;
+    }
+
+    if (menu_mode) {
+        // In menu mode - process menu keys
+        menu_process_key(current_key);
+    } else {
+        // In normal mode - check for menu entry key
+        if (current_key == KEY_MENU) {
+            menu_enter();
+        } else if (current_key == KEY_UP || current_key == KEY_DOWN) {
+            step_frequency(current_key == KEY_UP);
+        } else {
+            // Handle other normal mode keys here
+            send_uart_message("Key pressed in normal mode:");
+            uart_pr_send_byte('0' + current_key);
+            uart_pr_send_byte('\r');
+            uart_pr_send_byte('\n');
+        }
+    }
+
+    // Show the result of the key now rather than at the next refresh
+    sched_signal(SCHED_TASK_DISPLAY);
+}
+
+// Serve backup/restore requests from the programming cable
+static void task_uart(void) {
+    clone_poll();
+}
+
+// Advance queued I2C transactions: settings journal and channel programs.
+// A busy EEPROM just leaves its descriptor for the next run.
+static void task_i2c(void) {
+    i2c_queue_run();
+}
+
+// Feed receiver and battery readings to the screen; it only marks a region
+// dirty when a value actually moved
+static void task_sense(void) {
+    static u8 battery_countdown = 0;
+
+    screen_set_rssi(at1846s_get_rssi());
+    if (battery_countdown == 0) {
+        battery_countdown = SENSE_BATTERY_EVERY;
+        screen_set_battery(battery_read_voltage());
+    }
+    battery_countdown--;
+}
+
+// The periodic slot is the frame cap: changes merge until the next
+// SCREEN_FRAME_MS run. A handled key adds one immediate frame, at most once
+// per key repeat. Leaving the menu clears the LCD, so the main screen is
+// invalidated and drawn in full once.
+static void task_display(void) {
+    static u8 was_menu = 0;
+
+    if (menu_mode) {
+        was_menu = 1;
+        if (menu_display_dirty) {
+            menu_update_display();
+        }
+    } else {
+        if (was_menu) {
+            was_menu = 0;
+            screen_invalidate();
+        }
+        screen_update();
+    }
+}
+
+// Write coalesced settings changes once tuning has settled
+static void task_persist(void) {
+    settings_persist_poll();
+}
 
 // --- main ---
 void main(void) {
@@ -40,15 +166,22 @@ void main(void) {
     at1846s_init();
 
     delay_ms(6, 232);
+    watchdog_checkin(WATCHDOG_CLIENT_BOOT);
 
     // Initialize I2C bus before any EEPROM operations
     send_uart_message("Initializing I2C bus...");
     i2c_init();
     
+    // Settings slots A/B and the channel bitmap are adjacent pages: pull them
+    // into the EEPROM cache with one sequential read before their owners load
+    eeprom_cache_prefetch(SETTINGS_BASE_ADDR, (CHANNEL_BITMAP_ADDR - SETTINGS_BASE_ADDR) / EEPROM_PAGE_SIZE + 1);
+    
     // Initialize menu system and load settings
     send_uart_message("Initializing menu system...");
     menu_init();
     settings_init();
+    channel_init();
+    watchdog_checkin(WATCHDOG_CLIENT_BOOT);
     
     // === I2C TESTS ===
     send_uart_message("");
@@ -62,11 +195,7 @@ void main(void) {
     
     // Quick device check (A0-A2 are grounded, so address is 0xA0)
     send_uart_message("Testing basic device response...");
-    EA = 0; // Disable interrupts for I2C transaction
-    i2c_start();
-    __bit device_present = i2c_send(0xA0);
-    i2c_stop();
-    EA = 1; // Re-enable interrupts
+    __bit device_present = i2c_probe(0xA0);
     
     // Debug: Show device_present result
     send_uart_message("Device present result:");
@@ -105,6 +234,7 @@ void main(void) {
     // eeprom_scan_all_content();
     
     send_uart_message("=== EEPROM DIAGNOSTICS COMPLETE ===");
+    watchdog_checkin(WATCHDOG_CLIENT_BOOT);
     
     // === LCD TESTS ===
     send_uart_message("");
@@ -133,6 +263,7 @@ void main(void) {
     test_beep_all();
     
     send_uart_message("=== BEEP TESTS COMPLETE ===");
+    watchdog_checkin(WATCHDOG_CLIENT_BOOT);
     
     // AT1846S Communication Tests (Safe - No TX)
     send_uart_message("");
@@ -256,6 +387,7 @@ void main(void) {
     // Display chip information using proven SPI method
     send_uart_message("");
     send_uart_message("=== AT1846S CHIP INFORMATION ===");
+    watchdog_checkin(WATCHDOG_CLIENT_BOOT);
     
     u8 reg_low, reg_high;
     u16 chip_id, version, battery, rssi;
@@ -337,39 +469,28 @@ void main(void) {
     
     
     send_uart_message("=== TEST COMPLETE ===");
+    watchdog_checkin(WATCHDOG_CLIENT_BOOT);
     delay_ms(6,232);
+    watchdog_checkin(WATCHDOG_CLIENT_BOOT);
+
+    // Hand the main loop to the scheduler. The event slot stays free until an
+    // ISR posts events (see event.h), the scan slot until scanning exists
+    screen_init();
+    screen_show();
 
+    sched_init();
+    sched_add(SCHED_TASK_KEYPAD, task_keypad, KEYPAD_SCAN_MS);
+    sched_add(SCHED_TASK_UART, task_uart, 2);
+    sched_add(SCHED_TASK_I2C, task_i2c, 5);
+    sched_add(SCHED_TASK_RSSI, task_sense, SENSE_RSSI_MS);
+    sched_add(SCHED_TASK_DISPLAY, task_display, SCREEN_FRAME_MS);
+    sched_add(SCHED_TASK_PERSIST, task_persist, 100);
+
+    // From here the tick feeds the watchdog only while every periodic task
+    // keeps running; they take over from the boot client
+    watchdog_unregister(WATCHDOG_CLIENT_BOOT);
     while (1) {
-        watchdog_reset();
-        
-        // Check for key presses and handle menu system
-        u8 current_key = keypad_scan();
-        if (current_key != 0) {
-            if (menu_mode) {
-                // In menu mode - process menu keys
-                menu_process_key(current_key);
-            } else {
-                // In normal mode - check for menu entry key
-                if (current_key == KEY_MENU) {
-                    menu_enter();
-                } else {
-                    // Handle other normal mode keys here
-                    send_uart_message("Key pressed in normal mode:");
-                    uart_pr_send_byte('0' + current_key);
-                    uart_pr_send_byte('\r');
-                    uart_pr_send_byte('\n');
-                }
-            }
-        }
-        
-        // Update menu display if needed
-        if (menu_mode && menu_display_dirty) {
-            menu_update_display();
-        } else if (!menu_mode) {
-            // Update normal mode display
-            create_background_pattern();
-        }
-        
-        delay_ms(50, 0);  // Reduced delay for more responsive key handling
+        sched_run();
+        watchdog_report();
     }
 }
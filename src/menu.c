@@ -2,6 +2,7 @@
 #include "uart.h"
 #include "uart_test.h"
 #include "at1846s.h"
+#include "textfield.h"
 
 /**
  * Global menu state variables
@@ -16,10 +17,18 @@ __xdata volatile u16 menu_edit_value = 0;              // Current value being ed
 __xdata volatile u8 menu_last_cursor = 0xFF;           // Last cursor position for partial updates
 __xdata volatile u8 menu_current_start_item = 0;       // Current scroll window start position
 
+// List rows: each remembers the text on screen, so moving the scroll window
+// repaints only the characters that differ instead of clearing the list
+static __xdata textfield_t menu_rows[MENU_VISIBLE_ITEMS];
+static __xdata char menu_row_text[MENU_ROW_CELLS + 1];
+
+static void menu_render_row(u8 position, u8 item_index, u8 is_selected);
+
 // Item detail screen state
 __xdata volatile u8 menu_item_cursor = 0;              // Cursor position within item detail screen
 __xdata volatile u8 menu_item_selection = 0;           // Current selection for choice items
 __xdata volatile u16 menu_item_temp_value = 0;         // Temporary value during editing
+static __xdata u32 menu_freq_entry_khz;                // Digits typed on the FREQUENCY item, in kHz
 
 /**
  * Menu item definitions (stored in ROM to save RAM)
@@ -32,7 +41,7 @@ __xdata volatile u16 menu_item_temp_value = 0;         // Temporary value during
  */
 const __code menu_item_t menu_items[MENU_COUNT] = {
     // Core radio settings
-    {0,  "FREQUENCY",      MENU_TYPE_NUMERIC, 136000,  520000,  25,    0x0110},  // 136-520 MHz, 25kHz step
+    {0,  "FREQUENCY",      MENU_TYPE_NUMERIC, 0,       FREQ_INDEX_MAX, 4, 0x0110},  // 136-520 MHz as 6.25kHz indices, 25kHz step
     {1,  "STEP",           MENU_TYPE_NUMERIC, 1,       50000,   2,     0x0200},  // 1-50000 step 2
     {2,  "SQUELCH",        MENU_TYPE_NUMERIC, 0,       9,       1,     0x0114},  // 0-9
     {3,  "BANDWIDTH",      MENU_TYPE_CHOICE,  0,       1,       1,     0x0118},  // Wide/Narrow
@@ -331,7 +340,7 @@ void menu_edit_digit_input(u8 digit) {
  * Used by the function pointer system to eliminate switch statements
  */
 u16 menu_get_frequency(void) { 
-    return settings_get_frequency(); 
+    return freq_to_index(settings_get_frequency()); 
 }
 
 u16 menu_get_volume(void) { 
@@ -483,7 +492,7 @@ u16 menu_get_bluetooth(void) {
  * Used by the function pointer system to eliminate switch statements
  */
 void menu_set_frequency(u16 value) { 
-    settings_set_frequency(value); 
+    settings_set_frequency(freq_from_index(value)); 
     menu_apply_setting(MENU_FREQUENCY, value); 
 }
 
@@ -697,15 +706,13 @@ u16 menu_get_current_value(void) {
 /**
  * Set current menu item value in settings using function pointers
  * Optimized approach using function pointer array instead of switch statement
- * Automatically saves to EEPROM after successful update
+ * Settings setters mark the field dirty; settings_persist_poll() writes it later
  * @param value: New value to set for current menu item
  */
 void menu_set_current_value(u16 value) {
     const menu_value_ops_t* ops = &menu_value_ops[menu_cursor];
     if (ops->set_func) {
         ops->set_func(value);
-        // Save settings to EEPROM immediately after successful set
-        settings_save();
     }
 }
 
@@ -717,8 +724,8 @@ void menu_set_current_value(u16 value) {
  */
 void menu_apply_setting(u8 menu_id, u16 value) {
     switch (menu_id) {
-        case 0: // Frequency
-            at1846s_set_frequency((u32)value);
+        case 0: // Frequency (band-relative 6.25 kHz index)
+            at1846s_set_frequency_raw(freq_from_index(value));
             break;
         case 1: // Step
             // TODO: Implement frequency step setting
@@ -817,7 +824,7 @@ const menu_item_t* menu_get_current_item(void) {
  */
 void menu_update_display(void) {
     if (menu_display_dirty) {
-        u8 visible_items = 6;
+        u8 visible_items = MENU_VISIBLE_ITEMS;
         u8 new_start_item = menu_current_start_item;
         
         // Smart scrolling logic with hysteresis
@@ -834,8 +841,8 @@ void menu_update_display(void) {
         // If cursor is within current window, keep the same window
         
         // Check if we need full redraw or partial update
-        if (menu_last_cursor == 0xFF || new_start_item != menu_current_start_item) {
-            // First time rendering or scroll window changed - clear menu area only
+        if (menu_last_cursor == 0xFF) {
+            // First time rendering - clear menu area only
             menu_current_start_item = new_start_item;
             
             // Clear only the menu content area (below title and line)
@@ -843,6 +850,11 @@ void menu_update_display(void) {
             
             menu_render_new_style();
             menu_last_cursor = menu_cursor;
+        } else if (new_start_item != menu_current_start_item) {
+            // Scroll window changed - rows overwrite themselves, no clear
+            menu_current_start_item = new_start_item;
+            menu_render_rows();
+            menu_last_cursor = menu_cursor;
         } else if (menu_last_cursor != menu_cursor) {
             // Cursor moved within same window - partial update
             menu_render_partial_update(menu_last_cursor, menu_cursor);
@@ -858,13 +870,6 @@ void menu_update_display(void) {
  * Layout: Centered "MENU", horizontal line, numbered list items with values
  */
 void menu_render_new_style(void) {
-    u8 y_pos = 20;  // Increased spacing from line to first item
-    u8 visible_items = 6;  // Reduce items to save memory
-    u8 start_item = menu_current_start_item;  // Use current scroll window
-    
-    // Add watchdog reset
-    watchdog_reset();
-    
     // Centered "MENU" title - better centering calculation
     // MENU = 4 chars, each char = 12 pixels spacing, total = 4*12 = 48 pixels
     // Screen width = 160, so center = (160-48)/2 = 56
@@ -873,146 +878,84 @@ void menu_render_new_style(void) {
     // Horizontal line below title (moved further from title)
     draw_horizontal_line(10, 150, 16);
     
-    watchdog_reset(); // Reset before heavy rendering
-    
-    // Render visible menu items
-    for (u8 i = 0; i < visible_items && (start_item + i) < MENU_COUNT; i++) {
-        u8 item_index = start_item + i;
+    // The list area has just been cleared: forget what the rows showed
+    for (u8 i = 0; i < MENU_VISIBLE_ITEMS; i++) {
+        textfield_init(&menu_rows[i], MENU_ROW_X, MENU_ROW_Y + i * MENU_ROW_PITCH, MENU_ROW_CELLS,
+                       FONT_16X8, FONT_COLOR_WHITE, FONT_COLOR_BLACK);
+    }
+    menu_render_rows();
+}
+
+/**
+ * Bring every visible row up to date with the scroll window and cursor
+ */
+void menu_render_rows(void) {
+    for (u8 i = 0; i < MENU_VISIBLE_ITEMS; i++) {
+        u8 item_index = menu_current_start_item + i;
+        menu_render_row(i, item_index, item_index == menu_cursor);
+    }
+}
+
+/**
+ * Show one list row: 1-based number followed by the uppercase name,
+ * padded to the row width; rows past the end of the list are blank.
+ * Only cells whose character or colour changed reach the LCD.
+ */
+static void menu_render_row(u8 position, u8 item_index, u8 is_selected) {
+    textfield_t __xdata *row = &menu_rows[position];
+    char *p = menu_row_text;
+
+    if (item_index < MENU_COUNT) {
         const menu_item_t* item = &menu_items[item_index];
-        u8 current_y = y_pos + (i * 14);  // 14 pixel spacing between items
-        
-        // Reset watchdog every few items
-        if (i % 3 == 0) {
-            watchdog_reset();
-        }
-        
-        // Render decimal number (1-18)
         u8 display_number = item_index + 1;  // Convert to 1-based decimal
-        if (display_number < 10) {
-            // Single digit
-            if (item_index == menu_cursor) {
-                render_16x8_char_inverted(5, current_y, '0' + display_number);
-            } else {
-                render_16x8_char(5, current_y, '0' + display_number);
-            }
-        } else {
-            // Two digits (10-18)
-            u8 tens = display_number / 10;
-            u8 ones = display_number % 10;
-            if (item_index == menu_cursor) {
-                render_16x8_char_inverted(5, current_y, '0' + tens);
-                render_16x8_char_inverted(17, current_y, '0' + ones);
-            } else {
-                render_16x8_char(5, current_y, '0' + tens);
-                render_16x8_char(17, current_y, '0' + ones);
-            }
+        
+        if (display_number >= 10) {
+            *p++ = '0' + display_number / 10;
         }
+        *p++ = '0' + display_number % 10;
         
-        // Create uppercase name string (closer spacing to number)
-        static char name_buffer[12];  // Static to save stack space
-        u8 j = 0;
-        while (item->name[j] && j < 11) {  // Limit name length
+        // Uppercase name, cut at the row width
+        for (u8 j = 0; item->name[j] && p < &menu_row_text[MENU_ROW_CELLS]; j++) {
             char c = item->name[j];
             if (c >= 'a' && c <= 'z') {
                 c = c - 'a' + 'A';  // Convert to uppercase
             }
-            name_buffer[j] = c;
-            j++;
-        }
-        name_buffer[j] = '\0';
-        
-        // Render name with appropriate spacing for single/double digit numbers
-        u8 name_x_pos = (display_number < 10) ? 18 : 30;  // Closer for single digits
-        
-        if (item_index == menu_cursor) {
-            // Selected item - inverted text for name
-            render_16x8_string_inverted(name_x_pos, current_y, name_buffer);
-        } else {
-            // Normal item
-            render_16x8_string(name_x_pos, current_y, name_buffer);
+            *p++ = c;
         }
     }
+    *p = '\0';
     
-    watchdog_reset(); // Final reset
+    // Inverted bar across the whole row for the selected item
+    if (is_selected) {
+        textfield_set_colors(row, FONT_COLOR_BLACK, FONT_COLOR_WHITE);
+    } else {
+        textfield_set_colors(row, FONT_COLOR_WHITE, FONT_COLOR_BLACK);
+    }
+    textfield_set(row, menu_row_text);
 }
 
 /**
  * Render single menu item at specified position
  */
 void menu_render_single_item(u8 item_index, u8 is_selected) {
-    const menu_item_t* item = &menu_items[item_index];
-    u8 visible_items = 6;
-    
     // Use the global scroll window position instead of calculating independently
     // Check if this item is currently visible in the current scroll window
-    if (item_index < menu_current_start_item || item_index >= menu_current_start_item + visible_items) {
+    if (item_index < menu_current_start_item || item_index >= menu_current_start_item + MENU_VISIBLE_ITEMS) {
         return; // Item not visible, don't render
     }
     
-    u8 screen_position = item_index - menu_current_start_item;
-    u8 current_y = 20 + (screen_position * 14);
-    
-    // Clear the line first using consistent area clear function
-    menu_clear_area(5, current_y, 146, 8, 0x00, 0x00);
-    
-    // Render decimal number (1-18)
-    u8 display_number = item_index + 1;  // Convert to 1-based decimal
-    if (display_number < 10) {
-        // Single digit
-        if (is_selected) {
-            render_16x8_char_inverted(5, current_y, '0' + display_number);
-        } else {
-            render_16x8_char(5, current_y, '0' + display_number);
-        }
-    } else {
-        // Two digits (10-18)
-        u8 tens = display_number / 10;
-        u8 ones = display_number % 10;
-        if (is_selected) {
-            render_16x8_char_inverted(5, current_y, '0' + tens);
-            render_16x8_char_inverted(17, current_y, '0' + ones);
-        } else {
-            render_16x8_char(5, current_y, '0' + tens);
-            render_16x8_char(17, current_y, '0' + ones);
-        }
-    }
-    
-    // Create uppercase name
-    static char name_buffer[12];
-    u8 j = 0;
-    while (item->name[j] && j < 11) {
-        char c = item->name[j];
-        if (c >= 'a' && c <= 'z') {
-            c = c - 'a' + 'A';
-        }
-        name_buffer[j] = c;
-        j++;
-    }
-    name_buffer[j] = '\0';
-    
-    // Render name with appropriate spacing for single/double digit numbers
-    u8 name_x_pos = (display_number < 10) ? 18 : 30;  // Closer for single digits
-    
-    if (is_selected) {
-        render_16x8_string_inverted(name_x_pos, current_y, name_buffer);
-    } else {
-        render_16x8_string(name_x_pos, current_y, name_buffer);
-    }
+    menu_render_row(item_index - menu_current_start_item, item_index, is_selected);
 }
 
 /**
  * Partial screen update - only redraw changed items
  */
 void menu_render_partial_update(u8 old_cursor, u8 new_cursor) {
-    watchdog_reset();
-    
     // Redraw old cursor position as normal
     menu_render_single_item(old_cursor, 0);
     
     // Redraw new cursor position as selected
     menu_render_single_item(new_cursor, 1);
-    
-    watchdog_reset();
 }
 
 /**
@@ -1045,117 +988,6 @@ void menu_format_value_string(const menu_item_t* item, u16 value, char* buffer)
     }
 }
 
-/**
- * Format value as compact string for menu list display
- * Handles different menu item types with appropriate formatting
- * @param item: Menu item definition
- * @param value: Current value to format
- * @param buffer: Output buffer (should be at least 8 chars)
- */
-void menu_format_value_compact(const menu_item_t* item, u32 value, char* buffer) {
-    if (item->type == MENU_TYPE_CHOICE) {
-        // Handle specific choice items with meaningful labels
-        switch (item->id) {
-            case 3: // Bandwidth
-                if (value == 0) {
-                    buffer[0] = 'N'; buffer[1] = 'A'; buffer[2] = 'R'; buffer[3] = '\0'; // "NAR"
-                } else {
-                    buffer[0] = 'W'; buffer[1] = 'I'; buffer[2] = 'D'; buffer[3] = '\0'; // "WID"
-                }
-                break;
-            case 16: // DTMF Decode
-                switch (value) {
-                    case 0: buffer[0] = 'O'; buffer[1] = 'F'; buffer[2] = 'F'; buffer[3] = '\0'; break; // "OFF"
-                    case 1: buffer[0] = 'A'; buffer[1] = 'L'; buffer[2] = 'W'; buffer[3] = '\0'; break; // "ALW"
-                    case 2: buffer[0] = 'S'; buffer[1] = 'Q'; buffer[2] = 'L'; buffer[3] = '\0'; break; // "SQL"
-                    default: buffer[0] = '?'; buffer[1] = '\0'; break;
-                }
-                break;
-            case 18: // Tone Monitor
-                switch (value) {
-                    case 0: buffer[0] = 'O'; buffer[1] = 'F'; buffer[2] = 'F'; buffer[3] = '\0'; break; // "OFF"
-                    case 1: buffer[0] = 'O'; buffer[1] = 'N'; buffer[2] = '\0'; break; // "ON"
-                    case 2: buffer[0] = 'C'; buffer[1] = 'L'; buffer[2] = 'N'; buffer[3] = '\0'; break; // "CLN"
-                    default: buffer[0] = '?'; buffer[1] = '\0'; break;
-                }
-                break;
-            case 23: // Squelch Tail Eliminator
-                switch (value) {
-                    case 0: buffer[0] = 'O'; buffer[1] = 'F'; buffer[2] = 'F'; buffer[3] = '\0'; break; // "OFF"
-                    case 1: buffer[0] = 'R'; buffer[1] = 'X'; buffer[2] = '\0'; break; // "RX"
-                    case 2: buffer[0] = 'T'; buffer[1] = 'X'; buffer[2] = '\0'; break; // "TX"
-                    case 3: buffer[0] = 'B'; buffer[1] = 'T'; buffer[2] = 'H'; buffer[3] = '\0'; break; // "BTH"
-                    default: buffer[0] = '?'; buffer[1] = '\0'; break;
-                }
-                break;
-            case 24: // Key Tones
-                switch (value) {
-                    case 0: buffer[0] = 'O'; buffer[1] = 'F'; buffer[2] = 'F'; buffer[3] = '\0'; break; // "OFF"
-                    case 1: buffer[0] = 'O'; buffer[1] = 'N'; buffer[2] = '\0'; break; // "ON"
-                    case 2: buffer[0] = 'D'; buffer[1] = 'I'; buffer[2] = 'F'; buffer[3] = '\0'; break; // "DIF"
-                    case 3: buffer[0] = 'V'; buffer[1] = 'O'; buffer[2] = 'X'; buffer[3] = '\0'; break; // "VOX"
-                    default: buffer[0] = '?'; buffer[1] = '\0'; break;
-                }
-                break;
-            case 25: // Bluetooth
-                if (value == 0) {
-                    buffer[0] = 'O'; buffer[1] = 'F'; buffer[2] = 'F'; buffer[3] = '\0'; // "OFF"
-                } else {
-                    buffer[0] = 'O'; buffer[1] = 'N'; buffer[2] = '\0'; // "ON"
-                }
-                break;
-            default:
-                // Generic choice formatting
-                if (value == 0) {
-                    buffer[0] = 'O'; buffer[1] = 'F'; buffer[2] = 'F'; buffer[3] = '\0';
-                } else {
-                    buffer[0] = 'O'; buffer[1] = 'N'; buffer[2] = '\0';
-                }
-                break;
-        }
-    } else {
-        // Numeric formatting - compact for small screen
-        if (value == 0) {
-            buffer[0] = '0'; buffer[1] = '\0';
-        } else if (value < 10) {
-            buffer[0] = '0' + value; buffer[1] = '\0';
-        } else if (value < 100) {
-            buffer[0] = '0' + (value / 10);
-            buffer[1] = '0' + (value % 10);
-            buffer[2] = '\0';
-        } else if (value < 1000) {
-            buffer[0] = '0' + (value / 100);
-            buffer[1] = '0' + ((value / 10) % 10);
-            buffer[2] = '0' + (value % 10);
-            buffer[3] = '\0';
-        } else {
-            // For larger values (like frequency), show in compact form
-            if (value >= 100000) {
-                // Frequency in MHz (e.g., 446000 -> "446M")
-                u16 mhz = value / 1000;
-                if (mhz < 10) {
-                    buffer[0] = '0' + mhz; buffer[1] = 'M'; buffer[2] = '\0';
-                } else if (mhz < 100) {
-                    buffer[0] = '0' + (mhz / 10);
-                    buffer[1] = '0' + (mhz % 10);
-                    buffer[2] = 'M'; buffer[3] = '\0';
-                } else {
-                    buffer[0] = '0' + (mhz / 100);
-                    buffer[1] = '0' + ((mhz / 10) % 10);
-                    buffer[2] = '0' + (mhz % 10);
-                    buffer[3] = 'M'; buffer[4] = '\0';
-                }
-            } else {
-                // 4-digit numbers, show first 3 digits + "K" if needed
-                buffer[0] = '0' + (value / 1000);
-                buffer[1] = '0' + ((value / 100) % 10);
-                buffer[2] = '0' + ((value / 10) % 10);
-                buffer[3] = 'K'; buffer[4] = '\0';
-            }
-        }
-    }
-}
-
 /**
  * Get current value for specific menu item
  */
@@ -1220,8 +1052,8 @@ void menu_render_value(void) {
             }
         } else if (item->id == MENU_FREQUENCY) {
             // Display frequency as XXX.XXX MHz
-            u16 mhz_part = display_value / 1000;
-            u16 khz_part = display_value % 1000;
+            u16 mhz_part, khz_part;
+            freq_split(freq_from_index(display_value), &mhz_part, &khz_part);
             render_16x16_number(MENU_TEXT_X + 16, MENU_VALUE_Y, mhz_part);
             render_16x16_string(MENU_TEXT_X + 64, MENU_VALUE_Y, ".");
             render_16x16_number(MENU_TEXT_X + 80, MENU_VALUE_Y, khz_part);
@@ -1290,34 +1122,17 @@ void menu_render_navigation(void) {
  * @param color_lo: Low byte of 16-bit color
  */
 void menu_clear_area(u8 x, u8 y, u8 w, u8 h, u8 color_hi, u8 color_lo) {
-    u8 row, col;
-    
     lcd_set_window(x, y, x + w - 1, y + h - 1);
-    
-    for (row = 0; row < h; row++) {
-        for (col = 0; col < w; col++) {
-            lcd_send_data(color_hi);
-            lcd_send_data(color_lo);
-        }
-    }
+    lcd_fill_run(((u16)color_hi << 8) | color_lo, (u16)w * h);
 }
 
 /**
  * Clear entire screen for menu display (one-time use)
- * Uses working LCD pattern structure for reliable clearing
  * Only call this during menu initialization or major transitions
  */
 void menu_clear_screen(void) {
-    // Use working LCD pattern structure (clear_area has bugs)
-    u8 row, col;
-    
     lcd_set_window(0, 0, 159, 127);  // Set full screen window
-    for (row = 0; row < 128; row++) {
-        for (col = 0; col < 160; col++) {
-            lcd_send_data(0x00);  // Black high byte
-            lcd_send_data(0x00);  // Black low byte
-        }
-    }
+    lcd_fill_run(0x0000, 160 * 128);  // Black
 }
 
 /**
@@ -1332,6 +1147,7 @@ void menu_enter_item_detail(void) {
     
     // Load current value into temporary buffer
     menu_item_temp_value = menu_get_current_value();
+    menu_freq_entry_khz = 0;
     
     // For choice items, find current selection index
     if (item->type == MENU_TYPE_CHOICE) {
@@ -1438,6 +1254,20 @@ void menu_item_digit_input(u8 digit) {
             return; // Invalid digit
         }
         
+        // The value is a band index, so typed digits build a frequency in
+        // kHz that is snapped to the nearest 6.25 kHz step once in band
+        if (item->id == MENU_FREQUENCY) {
+            menu_freq_entry_khz = menu_freq_entry_khz * 10 + actual_digit;
+            if (menu_freq_entry_khz > FREQ_TO_KHZ(FREQ_BAND_MAX)) {
+                menu_freq_entry_khz = actual_digit; // Too many digits: start over
+            }
+            if (menu_freq_entry_khz >= FREQ_TO_KHZ(FREQ_BAND_MIN)) {
+                menu_item_temp_value = freq_to_index(FREQ_FROM_KHZ(menu_freq_entry_khz) + FREQ_INDEX_STEP / 2);
+                menu_display_dirty = 1;
+            }
+            return;
+        }
+
         // Shift current value and add new digit
         new_value = (u32)menu_item_temp_value * 10 + actual_digit;
         
@@ -1469,8 +1299,6 @@ void menu_render_item_detail(void) {
     // Clear screen first
     menu_clear_screen();
     
-    watchdog_reset();
-    
     // Calculate center position for item name  
     // Each character = 8 pixels width for proper centering
     const char* str = item->name;
@@ -1504,8 +1332,6 @@ void menu_render_item_detail(void) {
         // Show current value and allow editing
         menu_render_numeric_value(item, y_pos);
     }
-    
-    watchdog_reset();
 }
 
 /**
@@ -0,0 +1,152 @@
+#include "sched.h"
+#include "TA3782F.h"
+#include "tick.h"
+#include "watchdog.h"
+
+typedef struct {
+    sched_task_fn fn;   // NULL for an empty slot
+    u16 period;         // ms between runs, SCHED_EVENT_ONLY for signal-driven tasks
+    u32 deadline;       // tick_now() value of the next periodic run
+} sched_task_t;
+
+static __xdata sched_task_t sched_tasks[SCHED_TASKS];
+
+// Event flags are single bytes so an ISR can raise one with a plain store
+static volatile __xdata u8 sched_pending[SCHED_TASKS];
+
+__xdata sched_stats_t sched_stats[SCHED_TASKS];
+__xdata u32 sched_idle_passes;
+__xdata u32 sched_passes;
+__xdata u32 sched_idle_counts;
+
+// tick_now_counts() at the last stats reset, the base for sched_idle_percent()
+static __xdata u32 sched_window_start;
+
+void sched_init(void) {
+    for (u8 i = 0; i < SCHED_TASKS; i++) {
+        sched_tasks[i].fn = 0;
+        sched_pending[i] = 0;
+    }
+    sched_stats_reset();
+}
+
+// First run is due immediately so a task sees the initial state at startup
+void sched_add(u8 task, sched_task_fn fn, u16 period_ms) {
+    u32 timeout;
+
+    if (task >= SCHED_TASKS) {
+        return;
+    }
+    sched_tasks[task].period = period_ms;
+    sched_tasks[task].deadline = tick_now();
+    sched_pending[task] = 0;
+    sched_tasks[task].fn = fn;
+
+    // Event-only tasks may legitimately sleep forever, so only periodic ones are supervised
+    if (period_ms != SCHED_EVENT_ONLY) {
+        timeout = (u32)period_ms * SCHED_WATCHDOG_PERIODS;
+        if (timeout < SCHED_WATCHDOG_MIN_MS) {
+            timeout = SCHED_WATCHDOG_MIN_MS;
+        }
+        watchdog_register(task, timeout > 0xFFFF ? 0xFFFF : (u16)timeout);
+    }
+}
+
+void sched_remove(u8 task) {
+    if (task < SCHED_TASKS) {
+        watchdog_unregister(task);
+        sched_tasks[task].fn = 0;
+    }
+}
+
+// Safe from interrupt context
+void sched_signal(u8 task) {
+    if (task < SCHED_TASKS) {
+        sched_pending[task] = 1;
+    }
+}
+
+// Run the highest-priority runnable task, if any, to completion.
+// Returns 1 if a task ran, 0 if the pass was idle, in which case the CPU has
+// already slept until the next interrupt.
+__bit sched_run(void) {
+    sched_task_t __xdata *t;
+    u32 now = tick_now();
+    u32 elapsed;
+    __bit due;
+
+    sched_passes++;
+
+    for (u8 i = 0; i < SCHED_TASKS; i++) {
+        t = &sched_tasks[i];
+        if (!t->fn) {
+            continue;
+        }
+
+        due = t->period != SCHED_EVENT_ONLY && (i32)(now - t->deadline) >= 0;
+        if (sched_pending[i]) {
+            // Clear before running so a signal raised mid-run isn't lost
+            sched_pending[i] = 0;
+        } else if (!due) {
+            continue;
+        }
+
+        // A signalled run leaves the periodic schedule alone
+        if (due) {
+            // Re-arm from the old deadline to avoid drift, but don't try to
+            // catch up on periods missed behind a long task
+            t->deadline += t->period;
+            if ((i32)(now - t->deadline) >= 0) {
+                t->deadline = now + t->period;
+            }
+        }
+
+        t->fn();
+        watchdog_checkin(i);
+
+        elapsed = tick_now() - now;
+        sched_stats[i].runs++;
+        if (elapsed > sched_stats[i].max_ms) {
+            sched_stats[i].max_ms = elapsed > 0xFFFF ? 0xFFFF : (u16)elapsed;
+        }
+        return 1;
+    }
+
+    sched_idle_passes++;
+    sched_idle();
+    return 0;
+}
+
+// Halt the CPU until any enabled interrupt. The tick ISR fires every
+// millisecond, so deadlines are never missed by more than one tick, and
+// any other enabled ISR (Bluetooth RX) cuts the sleep short. A
+// signal raised between the runnable scan and PCON costs at most that tick.
+void sched_idle(void) {
+    u32 start = tick_now_counts();
+
+    PCON |= PCON_IDL;
+    // Execution resumes here after the waking ISR returns
+    sched_idle_counts += tick_now_counts() - start;
+}
+
+// Share of wall time spent in CPU idle since the last sched_stats_reset()
+u8 sched_idle_percent(void) {
+    u32 window = (tick_now_counts() - sched_window_start) / 100;
+
+    if (window == 0) {
+        return 0;
+    }
+    window = sched_idle_counts / window;
+    return window > 100 ? 100 : (u8)window;
+}
+
+void sched_stats_reset(void) {
+    for (u8 i = 0; i < SCHED_TASKS; i++) {
+        sched_stats[i].runs = 0;
+        sched_stats[i].max_ms = 0;
+    }
+    sched_idle_passes = 0;
+    sched_passes = 0;
+    sched_idle_counts = 0;
+    sched_window_start = tick_now_counts();
+}
@@ -0,0 +1,220 @@
+#include "screen.h"
+#include "textfield.h"
+#include "settings.h"
+#include "lcd.h"
+
+// Layout, 16x8 font at 12 px per cell
+#define SCREEN_MODE_X           8
+#define SCREEN_MODE_Y           8
+#define SCREEN_BATTERY_CELLS    4       // "7.4V"
+#define SCREEN_BATTERY_X        (DISPLAY_WIDTH - 8 - SCREEN_BATTERY_CELLS * SPACING_BETWEEN_CHARS)
+#define SCREEN_FREQ_X           ((DISPLAY_WIDTH - SCREEN_FREQ_CELLS * SPACING_BETWEEN_CHARS) / 2)
+#define SCREEN_FREQ_Y           44
+#define SCREEN_RSSI_X           8
+#define SCREEN_RSSI_Y           62
+#define SCREEN_RSSI_WIDTH       144
+#define SCREEN_RSSI_HEIGHT      4
+#define SCREEN_STATUS_X         8
+#define SCREEN_STATUS_Y         88
+#define SCREEN_STATUS2_Y        104
+#define SCREEN_STATUS_CELLS     12
+
+static __xdata textfield_t screen_mode;
+static __xdata textfield_t screen_battery;
+static __xdata textfield_t screen_freq;
+static __xdata textfield_t screen_status;
+static __xdata textfield_t screen_status2;
+
+// Formatting scratch, one line of 16x8 text
+static __xdata char screen_text[TEXTFIELD_MAX_CELLS + 1];
+
+static __xdata u8 screen_dirty;
+__xdata u16 screen_frames;
+
+// Latest sensor values, and the RSSI bar length currently on the LCD
+static __xdata u8 screen_rssi;
+static __xdata u16 screen_battery_tenths;
+static __xdata u8 screen_rssi_shown;
+
+void screen_init(void) {
+    textfield_init(&screen_mode, SCREEN_MODE_X, SCREEN_MODE_Y, 3,
+                   FONT_16X8, FONT_COLOR_GREY, FONT_COLOR_BLACK);
+    textfield_init(&screen_battery, SCREEN_BATTERY_X, SCREEN_MODE_Y, SCREEN_BATTERY_CELLS,
+                   FONT_16X8, FONT_COLOR_GREY, FONT_COLOR_BLACK);
+    textfield_init(&screen_freq, SCREEN_FREQ_X, SCREEN_FREQ_Y, SCREEN_FREQ_CELLS,
+                   FONT_16X8, FONT_COLOR_WHITE, FONT_COLOR_BLACK);
+    textfield_init(&screen_status, SCREEN_STATUS_X, SCREEN_STATUS_Y, SCREEN_STATUS_CELLS,
+                   FONT_16X8, FONT_COLOR_WHITE, FONT_COLOR_BLACK);
+    textfield_init(&screen_status2, SCREEN_STATUS_X, SCREEN_STATUS2_Y, SCREEN_STATUS_CELLS,
+                   FONT_16X8, FONT_COLOR_WHITE, FONT_COLOR_BLACK);
+    screen_invalidate();
+}
+
+// Clear the LCD and draw every region from scratch
+void screen_show(void) {
+    clear_area(0, 0, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1);
+    screen_invalidate();
+    screen_update();
+}
+
+// The LCD no longer shows the regions (menu exit, external clear): forget
+// what is on it and repaint everything on the next frame
+void screen_invalidate(void) {
+    textfield_invalidate(&screen_mode);
+    textfield_invalidate(&screen_battery);
+    textfield_invalidate(&screen_freq);
+    textfield_invalidate(&screen_status);
+    textfield_invalidate(&screen_status2);
+    screen_rssi_shown = 0;      // Caller has cleared the bar area
+    screen_dirty = SCREEN_REGION_ALL;
+}
+
+void screen_mark_dirty(u8 regions) {
+    screen_dirty |= regions;
+}
+
+void screen_set_rssi(u8 rssi) {
+    if (rssi != screen_rssi) {
+        screen_rssi = rssi;
+        screen_dirty |= SCREEN_REGION_RSSI;
+    }
+}
+
+void screen_set_battery(u16 tenths_volt) {
+    if (tenths_volt != screen_battery_tenths) {
+        screen_battery_tenths = tenths_volt;
+        screen_dirty |= SCREEN_REGION_BATTERY;
+    }
+}
+
+// Write value as exactly digits decimal digits, zero padded
+static char *screen_put_digits(char *p, u16 value, u8 digits) {
+    p += digits;
+    for (u8 i = 0; i < digits; i++) {
+        *--p = '0' + (value % 10);
+        value /= 10;
+    }
+    return p + digits;
+}
+
+// "446.00625": MHz, kHz, then tens of Hz. Sub-kHz units are 62.5 Hz, so
+// units * 625 / 100 is exact in tens of Hz for every 6.25 kHz multiple.
+static void screen_format_freq(char *p, freq_t freq) {
+    u16 mhz;
+    u16 khz;
+
+    freq_split(freq, &mhz, &khz);
+    p = screen_put_digits(p, mhz, 3);
+    *p++ = '.';
+    p = screen_put_digits(p, khz, 3);
+    p = screen_put_digits(p, (u16)(freq & ((1 << FREQ_UNIT_SHIFT) - 1)) * 625 / 100, 2);
+    *p = '\0';
+}
+
+// "7.4V", one decimal
+static void screen_draw_battery(void) {
+    char *p = screen_text;
+    u16 tenths = screen_battery_tenths;
+
+    if (tenths > 99) {
+        tenths = 99;
+    }
+    p = screen_put_digits(p, tenths / 10, 1);
+    *p++ = '.';
+    p = screen_put_digits(p, tenths % 10, 1);
+    *p++ = 'V';
+    *p = '\0';
+    textfield_set(&screen_battery, screen_text);
+}
+
+// Grow or shrink the bar by the difference only
+static void screen_draw_rssi(void) {
+    u8 length = (u8)(((u16)screen_rssi * SCREEN_RSSI_WIDTH) / 255);
+    u8 from = screen_rssi_shown;
+
+    if (length == from) {
+        return;
+    }
+    if (length > from) {
+        lcd_set_window(SCREEN_RSSI_X + from, SCREEN_RSSI_Y,
+                       SCREEN_RSSI_X + length - 1, SCREEN_RSSI_Y + SCREEN_RSSI_HEIGHT - 1);
+        lcd_fill_run(FONT_COLOR_GREEN, (u16)(length - from) * SCREEN_RSSI_HEIGHT);
+    } else {
+        clear_area(SCREEN_RSSI_X + length, SCREEN_RSSI_Y,
+                   SCREEN_RSSI_X + from - 1, SCREEN_RSSI_Y + SCREEN_RSSI_HEIGHT - 1);
+    }
+    screen_rssi_shown = length;
+}
+
+// "VOL 08 SQL 3"
+static void screen_draw_status(void) {
+    char *p = screen_text;
+
+    *p++ = 'V'; *p++ = 'O'; *p++ = 'L'; *p++ = ' ';
+    p = screen_put_digits(p, settings_get_volume(), 2);
+    *p++ = ' '; *p++ = 'S'; *p++ = 'Q'; *p++ = 'L'; *p++ = ' ';
+    p = screen_put_digits(p, settings_get_squelch(), 1);
+    *p = '\0';
+    textfield_set(&screen_status, screen_text);
+}
+
+// "PWR 4 CT 12" / "PWR 4 CT OFF"
+static void screen_draw_status2(void) {
+    char *p = screen_text;
+    u8 ctcss = settings_get_ctcss();
+
+    *p++ = 'P'; *p++ = 'W'; *p++ = 'R'; *p++ = ' ';
+    p = screen_put_digits(p, settings_get_power(), 1);
+    *p++ = ' '; *p++ = 'C'; *p++ = 'T'; *p++ = ' ';
+    if (ctcss) {
+        p = screen_put_digits(p, ctcss, 2);
+    } else {
+        *p++ = 'O'; *p++ = 'F'; *p++ = 'F';
+    }
+    *p = '\0';
+    textfield_set(&screen_status2, screen_text);
+}
+
+// Compositor: fold in settings changes, then repaint the dirty regions.
+// With nothing dirty this touches neither the LCD nor the formatters.
+void screen_update(void) {
+    u8 changes = settings_take_changes();
+    u8 dirty;
+
+    if (changes & (1 << SETTINGS_FIELD_FREQUENCY)) {
+        screen_dirty |= SCREEN_REGION_FREQ;
+    }
+    if (changes & ((1 << SETTINGS_FIELD_VOLUME) | (1 << SETTINGS_FIELD_SQUELCH))) {
+        screen_dirty |= SCREEN_REGION_STATUS;
+    }
+    if (changes & ((1 << SETTINGS_FIELD_POWER) | (1 << SETTINGS_FIELD_CTCSS))) {
+        screen_dirty |= SCREEN_REGION_STATUS2;
+    }
+
+    dirty = screen_dirty;
+    if (!dirty) {
+        return;
+    }
+    screen_dirty = 0;
+    screen_frames++;
+
+    if (dirty & SCREEN_REGION_MODE) {
+        textfield_set(&screen_mode, "VFO");
+    }
+    if (dirty & SCREEN_REGION_BATTERY) {
+        screen_draw_battery();
+    }
+    if (dirty & SCREEN_REGION_FREQ) {
+        screen_format_freq(screen_text, settings_get_frequency());
+        textfield_set(&screen_freq, screen_text);
+    }
+    if (dirty & SCREEN_REGION_RSSI) {
+        screen_draw_rssi();
+    }
+    if (dirty & SCREEN_REGION_STATUS) {
+        screen_draw_status();
+    }
+    if (dirty & SCREEN_REGION_STATUS2) {
+        screen_draw_status2();
+    }
+}
@@ -5,6 +5,96 @@
 // Global settings instance in XDATA
 __xdata settings_t current_settings;
 
+// Values currently held by snapshot + journal; saves only append fields that differ
+static __xdata settings_t settings_persisted;
+
+// Page buffer shared by snapshot and journal I/O (must be XDATA for the I2C queue)
+static __xdata u8 settings_image[SETTINGS_SIZE];
+
+// Journal position, rebuilt by the boot scan
+static __xdata u16 journal_seq;           // Newest sequence number written (page or snapshot)
+static __xdata u16 journal_snapshot_seq;  // Sequence number covered by the snapshot
+static __xdata u8 journal_head;           // Ring index of the page currently being appended
+static __xdata u8 journal_head_used;      // Record slots used in the head page
+static __xdata u8 journal_live_pages;     // Pages newer than the snapshot
+
+// Deferred persistence: fields changed since the last write, and when the last change happened
+static __xdata u8 settings_dirty;
+static __xdata u32 settings_changed_at;
+
+// Fields changed since the display last looked, independent of persistence
+static __xdata u8 settings_unseen;
+
+// Snapshot slot holding the newest image; compaction writes the other one
+static __xdata u8 settings_active_slot = SETTINGS_SLOTS - 1;
+
+// Journal or snapshot program in flight through the I2C queue. The journal
+// position and settings_persisted move only once it has landed, so a failed
+// program leaves RAM describing the EEPROM and the fields are simply written
+// again. settings_image holds the bytes until then.
+#define SETTINGS_WRITE_NONE     0
+#define SETTINGS_WRITE_RECORDS  1       // Records appended to the head page
+#define SETTINGS_WRITE_PAGE     2       // Next journal page opened
+#define SETTINGS_WRITE_SNAPSHOT 3       // Compaction into the inactive slot
+
+static __xdata i2c_xfer_t settings_xfer;
+static __xdata u8 settings_write_kind;
+static __xdata u8 settings_write_mask;     // Fields carried by the write
+static __xdata u8 settings_write_count;    // Records carried by the write
+static __xdata u8 settings_write_head;     // Ring index of a newly opened page
+static __xdata u16 settings_write_seq;     // Sequence of a new page or snapshot
+static __xdata settings_t settings_written; // Values the write carries
+
+// Sequence comparison that survives 16-bit wraparound
+#define SEQ_NEWER(a, b)     ((i16)((u16)(a) - (u16)(b)) > 0)
+
+static u32 settings_field_get(const __xdata settings_t *s, u8 field) {
+    switch (field) {
+        case SETTINGS_FIELD_FREQUENCY: return s->frequency;
+        case SETTINGS_FIELD_VOLUME:    return s->volume;
+        case SETTINGS_FIELD_SQUELCH:   return s->squelch;
+        case SETTINGS_FIELD_POWER:     return s->power;
+        case SETTINGS_FIELD_BACKLIGHT: return s->backlight;
+        default:                       return s->ctcss;
+    }
+}
+
+static void settings_field_put(__xdata settings_t *s, u8 field, u32 value) {
+    switch (field) {
+        case SETTINGS_FIELD_FREQUENCY: s->frequency = value;      break;
+        case SETTINGS_FIELD_VOLUME:    s->volume = (u16)value;    break;
+        case SETTINGS_FIELD_SQUELCH:   s->squelch = (u16)value;   break;
+        case SETTINGS_FIELD_POWER:     s->power = (u16)value;     break;
+        case SETTINGS_FIELD_BACKLIGHT: s->backlight = (u16)value; break;
+        default:                       s->ctcss = (u16)value;     break;
+    }
+}
+
+// Mark everything in RAM as persisted
+static void settings_sync_persisted(void) {
+    for (u8 field = 0; field < SETTINGS_FIELD_COUNT; field++) {
+        settings_field_put(&settings_persisted, field, settings_field_get(&current_settings, field));
+    }
+}
+
+// Check byte binds a record to its page sequence so torn or stale slots are rejected
+static u8 settings_record_check(u16 seq, const __xdata u8 *record) {
+    u16 crc = crc16_update(CRC16_INIT, (u8)seq);
+    for (u8 i = 0; i < SETTINGS_JOURNAL_REC_SIZE - 1; i++) {
+        crc = crc16_update(crc, record[i]);
+    }
+    return (u8)crc;
+}
+
+static void settings_record_fill(__xdata u8 *record, u16 seq, u8 field) {
+    u32 value = settings_field_get(&current_settings, field);
+    record[0] = field;
+    record[1] = (u8)(value >> 16);
+    record[2] = (u8)(value >> 8);
+    record[3] = (u8)value;
+    record[4] = settings_record_check(seq, record);
+}
+
 // Initialize settings system
 void settings_init(void) {
     send_uart_message("Initializing settings...");
@@ -12,133 +102,382 @@ void settings_init(void) {
     if (!settings_load()) {
         send_uart_message("Loading defaults");
         settings_load_defaults();
-        settings_save();
+        settings_compact();
     } else {
         send_uart_message("Settings loaded from EEPROM");
     }
 }
 
-// Load settings from EEPROM
-__bit settings_load(void) {
-    u8 temp_data[2];
+// Check magic, version and CRC of a snapshot image
+static __bit settings_slot_valid(const __xdata u8 *image) {
     u16 temp_value;
-    
-    // Read magic number
-    if (!eeprom_read(SETTINGS_MAGIC_ADDR, temp_data, 2)) {
-        send_uart_message("EEPROM read failed");
+
+    temp_value = ((u16)image[SETTINGS_OFS_MAGIC] << 8) | image[SETTINGS_OFS_MAGIC + 1];
+    if (temp_value != SETTINGS_MAGIC || image[SETTINGS_OFS_VERSION] != SETTINGS_VERSION) {
         return 0;
     }
-    temp_value = ((u16)temp_data[0] << 8) | temp_data[1];
-    if (temp_value != SETTINGS_MAGIC) {
-        send_uart_message("Settings magic invalid");
+
+    temp_value = ((u16)image[SETTINGS_OFS_CRC] << 8) | image[SETTINGS_OFS_CRC + 1];
+    return temp_value == settings_calculate_crc(image);
+}
+
+// Read both snapshot slots (one sequential prefetch into the EEPROM cache,
+// a no-op if boot already pulled them in) and unpack the newest valid one
+static __bit settings_load_snapshot(void) {
+    __bit found = 0;
+    u16 seq;
+    u8 slot;
+
+    if (!eeprom_cache_prefetch(SETTINGS_BASE_ADDR, SETTINGS_SLOTS)) {
+        send_uart_message("EEPROM read failed");
         return 0;
     }
-    current_settings.magic = temp_value;
-    
-    // Read version
-    if (!eeprom_read(SETTINGS_VERSION_ADDR, temp_data, 2)) return 0;
-    temp_value = ((u16)temp_data[0] << 8) | temp_data[1];
-    if (temp_value != SETTINGS_VERSION) {
-        send_uart_message("Settings version mismatch");
+
+    for (slot = 0; slot < SETTINGS_SLOTS; slot++) {
+        if (!eeprom_cache_read(SETTINGS_BASE_ADDR + (u16)slot * SETTINGS_SIZE, settings_image, SETTINGS_SIZE) ||
+            !settings_slot_valid(settings_image)) {
+            continue; // Blank, older format or torn by a power cut
+        }
+
+        seq = ((u16)settings_image[SETTINGS_OFS_SEQUENCE] << 8) | settings_image[SETTINGS_OFS_SEQUENCE + 1];
+        if (!found || SEQ_NEWER(seq, journal_snapshot_seq)) {
+            found = 1;
+            settings_active_slot = slot;
+            journal_snapshot_seq = seq;
+            settings_unpack(settings_image);
+        }
+    }
+
+    if (!found) {
+        send_uart_message("No valid settings slot");
+    }
+    return found;
+}
+
+// Replay the journal on top of current_settings in one pass over the ring. Each
+// page is its own short read so the bus lock, and with it EA, is released
+// between pages and the tick keeps feeding the watchdog.
+// Returns 1 if at least one record was applied.
+static __bit settings_journal_scan(__bit snapshot_valid) {
+    static __xdata u16 best_seq[SETTINGS_FIELD_COUNT];
+    static __xdata u8 best_slot[SETTINGS_FIELD_COUNT];
+    __bit applied = 0;
+    __bit have_page = 0;
+    u16 newest_seq = 0;
+    u8 newest_page = SETTINGS_JOURNAL_PAGES - 1;
+    u8 newest_used = SETTINGS_JOURNAL_RECS;
+    u8 page, slot, field, used;
+    u16 seq;
+    const __xdata u8 *record;
+
+    for (field = 0; field < SETTINGS_FIELD_COUNT; field++) {
+        best_slot[field] = 0xFF;
+    }
+    journal_live_pages = 0;
+
+    for (page = 0; page < SETTINGS_JOURNAL_PAGES; page++) {
+        if (!eeprom_read(SETTINGS_JOURNAL_ADDR + page * SETTINGS_JOURNAL_PAGE_SIZE,
+                         settings_image, SETTINGS_JOURNAL_PAGE_SIZE)) {
+            break; // Bus failure: keep what the earlier pages gave
+        }
+
+        seq = ((u16)settings_image[0] << 8) | settings_image[1];
+        if (seq == SETTINGS_JOURNAL_SEQ_FREE) {
+            continue; // Never used
+        }
+
+        // Slots fill in order, so the last non-empty slot marks the fill level
+        used = 0;
+        for (slot = 0; slot < SETTINGS_JOURNAL_RECS; slot++) {
+            if (settings_image[SETTINGS_JOURNAL_HDR_SIZE + slot * SETTINGS_JOURNAL_REC_SIZE] != SETTINGS_JOURNAL_FREE) {
+                used = slot + 1;
+            }
+        }
+
+        if (!have_page || SEQ_NEWER(seq, newest_seq)) {
+            have_page = 1;
+            newest_seq = seq;
+            newest_page = page;
+            newest_used = used;
+        }
+
+        if (snapshot_valid && !SEQ_NEWER(seq, journal_snapshot_seq)) {
+            continue; // Already folded into the snapshot
+        }
+        journal_live_pages++;
+
+        for (slot = 0; slot < used; slot++) {
+            record = &settings_image[SETTINGS_JOURNAL_HDR_SIZE + slot * SETTINGS_JOURNAL_REC_SIZE];
+            field = record[0];
+            if (field >= SETTINGS_FIELD_COUNT || record[4] != settings_record_check(seq, record)) {
+                continue; // Empty, unknown or torn record
+            }
+            if (best_slot[field] == 0xFF || SEQ_NEWER(seq, best_seq[field]) ||
+                (seq == best_seq[field] && slot > best_slot[field])) {
+                best_seq[field] = seq;
+                best_slot[field] = slot;
+                settings_field_put(&current_settings, field,
+                                   ((u32)record[1] << 16) | ((u16)record[2] << 8) | record[3]);
+                applied = 1;
+            }
+        }
+    }
+
+    // Continue appending after the newest page; a stale head forces a fresh page
+    journal_head = newest_page;
+    if (!have_page || (snapshot_valid && !SEQ_NEWER(newest_seq, journal_snapshot_seq))) {
+        journal_seq = snapshot_valid ? journal_snapshot_seq : 0;
+        journal_head_used = SETTINGS_JOURNAL_RECS;
+    } else {
+        journal_seq = newest_seq;
+        journal_head_used = newest_used;
+    }
+
+    return applied;
+}
+
+// Load settings from EEPROM: newest snapshot slot, then journal replay
+__bit settings_load(void) {
+    __bit snapshot_valid;
+
+    // Everything is rebuilt from the device, so a queued write only has to land
+    eeprom_sync();
+    settings_write_kind = SETTINGS_WRITE_NONE;
+
+    snapshot_valid = settings_load_snapshot();
+
+    if (!snapshot_valid) {
+        settings_load_defaults();
+    }
+
+    if (!settings_journal_scan(snapshot_valid) && !snapshot_valid) {
         return 0;
     }
-    current_settings.version = temp_value;
-    
-    // Read frequency
-    if (!eeprom_read(SETTING_FREQUENCY_ADDR, temp_data, 2)) return 0;
-    current_settings.frequency = ((u16)temp_data[0] << 8) | temp_data[1];
-    
-    // Read volume
-    if (!eeprom_read(SETTING_VOLUME_ADDR, temp_data, 2)) return 0;
-    current_settings.volume = ((u16)temp_data[0] << 8) | temp_data[1];
-    
-    // Read squelch
-    if (!eeprom_read(SETTING_SQUELCH_ADDR, temp_data, 2)) return 0;
-    current_settings.squelch = ((u16)temp_data[0] << 8) | temp_data[1];
-    
-    // Read power
-    if (!eeprom_read(SETTING_POWER_ADDR, temp_data, 2)) return 0;
-    current_settings.power = ((u16)temp_data[0] << 8) | temp_data[1];
-    
-    // Read backlight
-    if (!eeprom_read(SETTING_BACKLIGHT_ADDR, temp_data, 2)) return 0;
-    current_settings.backlight = ((u16)temp_data[0] << 8) | temp_data[1];
-    
-    // Read CTCSS
-    if (!eeprom_read(SETTING_CTCSS_ADDR, temp_data, 2)) return 0;
-    current_settings.ctcss = ((u16)temp_data[0] << 8) | temp_data[1];
-    
-    // Read checksum
-    if (!eeprom_read(SETTINGS_CHECKSUM_ADDR, temp_data, 2)) return 0;
-    current_settings.checksum = ((u16)temp_data[0] << 8) | temp_data[1];
-    
+
     // Validate settings
     if (!settings_validate()) {
         send_uart_message("Settings validation failed");
         return 0;
     }
-    
+
+    settings_sync_persisted();
+    return 1;
+}
+
+// Queue the program prepared in settings_image; fields lists the values it carries
+static __bit settings_write_submit(u8 kind, u16 addr, u8 size, u8 fields) {
+    if (!eeprom_program_submit(&settings_xfer, addr, settings_image, size)) {
+        return 0;
+    }
+    for (u8 field = 0; field < SETTINGS_FIELD_COUNT; field++) {
+        settings_field_put(&settings_written, field, settings_field_get(&current_settings, field));
+    }
+    settings_write_kind = kind;
+    settings_write_mask = fields;
+    return 1;
+}
+
+// Adopt a finished write: advance the journal and record what the EEPROM now
+// holds. A failed one puts its fields back in line for the next flush.
+static void settings_write_poll(void) {
+    u8 field;
+
+    if (settings_write_kind == SETTINGS_WRITE_NONE || settings_xfer.status == I2C_XFER_QUEUED) {
+        return;
+    }
+
+    if (settings_xfer.status != I2C_XFER_DONE) {
+        send_uart_message("Failed to save settings");
+        settings_dirty |= settings_write_mask;
+        settings_changed_at = tick_now(); // Retry after another quiet period
+        settings_write_kind = SETTINGS_WRITE_NONE;
+        return;
+    }
+
+    switch (settings_write_kind) {
+        case SETTINGS_WRITE_RECORDS:
+            journal_head_used += settings_write_count;
+            break;
+
+        case SETTINGS_WRITE_PAGE:
+            journal_head = settings_write_head;
+            journal_seq = settings_write_seq;
+            journal_head_used = settings_write_count;
+            journal_live_pages++;
+            break;
+
+        case SETTINGS_WRITE_SNAPSHOT:
+            settings_active_slot ^= 1;
+            journal_seq = settings_write_seq;
+            journal_snapshot_seq = settings_write_seq;
+            journal_live_pages = 0;
+            journal_head_used = SETTINGS_JOURNAL_RECS; // Next append opens a fresh page
+            send_uart_message("Settings saved successfully");
+            break;
+    }
+
+    for (field = 0; field < SETTINGS_FIELD_COUNT; field++) {
+        if (settings_write_mask & (1 << field)) {
+            settings_field_put(&settings_persisted, field, settings_field_get(&settings_written, field));
+        }
+    }
+    settings_write_kind = SETTINGS_WRITE_NONE;
+}
+
+// Queue the records for changed fields as one page program
+static __bit settings_journal_append(const __xdata u8 *fields, u8 count, u8 mask) {
+    u16 addr;
+    u16 seq;
+    u8 i;
+
+    settings_write_count = count;
+
+    if (journal_head_used + count <= SETTINGS_JOURNAL_RECS) {
+        // Room left in the head page: program just the new records
+        for (i = 0; i < count; i++) {
+            settings_record_fill(&settings_image[i * SETTINGS_JOURNAL_REC_SIZE], journal_seq, fields[i]);
+        }
+        addr = SETTINGS_JOURNAL_ADDR + (u16)journal_head * SETTINGS_JOURNAL_PAGE_SIZE +
+               SETTINGS_JOURNAL_HDR_SIZE + journal_head_used * SETTINGS_JOURNAL_REC_SIZE;
+        return settings_write_submit(SETTINGS_WRITE_RECORDS, addr, count * SETTINGS_JOURNAL_REC_SIZE, mask);
+    }
+
+    // Ring full of live pages: fold everything into a new snapshot instead
+    if (journal_live_pages >= SETTINGS_JOURNAL_PAGES) {
+        return settings_compact();
+    }
+
+    // Open the next page: header, records and erased remainder in one page program
+    seq = journal_seq + 1;
+    if (seq == SETTINGS_JOURNAL_SEQ_FREE) {
+        seq = 0;
+    }
+    for (i = 0; i < SETTINGS_JOURNAL_PAGE_SIZE; i++) {
+        settings_image[i] = 0xFF;
+    }
+    settings_image[0] = (u8)(seq >> 8);
+    settings_image[1] = (u8)seq;
+    for (i = 0; i < count; i++) {
+        settings_record_fill(&settings_image[SETTINGS_JOURNAL_HDR_SIZE + i * SETTINGS_JOURNAL_REC_SIZE], seq, fields[i]);
+    }
+
+    i = journal_head + 1;
+    if (i == SETTINGS_JOURNAL_PAGES) {
+        i = 0;
+    }
+    settings_write_head = i;
+    settings_write_seq = seq;
+    return settings_write_submit(SETTINGS_WRITE_PAGE, SETTINGS_JOURNAL_ADDR + (u16)i * SETTINGS_JOURNAL_PAGE_SIZE,
+                                 SETTINGS_JOURNAL_PAGE_SIZE, mask);
+}
+
+// Queue journal records for the fields in mask whose value differs from EEPROM.
+// Returns 0 if nothing could be queued, including while a write is in flight.
+static __bit settings_write_fields(u8 mask) {
+    static __xdata u8 changed[SETTINGS_FIELD_COUNT];
+    u8 count = 0;
+    u8 changed_mask = 0;
+    u8 field;
+
+    if (settings_write_kind != SETTINGS_WRITE_NONE) {
+        return 0;
+    }
+
+    for (field = 0; field < SETTINGS_FIELD_COUNT; field++) {
+        if ((mask & (1 << field)) &&
+            settings_field_get(&current_settings, field) != settings_field_get(&settings_persisted, field)) {
+            changed[count++] = field;
+            changed_mask |= (u8)(1 << field);
+        }
+    }
+
+    if (count == 0) {
+        return 1; // Nothing new to persist
+    }
+
+    if (!settings_journal_append(changed, count, changed_mask)) {
+        send_uart_message("Failed to save settings");
+        return 0;
+    }
     return 1;
 }
 
-// Save settings to EEPROM
+// Queue a journal record for every changed field. The program completes
+// in the background; settings_persist_poll() adopts the result.
 __bit settings_save(void) {
-    __xdata static u8 temp_data[2];  // Make static and in XDATA
-    
-    // Update checksum before saving
-    current_settings.checksum = settings_calculate_checksum();
-    
-    send_uart_message("Saving settings to EEPROM...");
-    
-    // Save magic number
-    temp_data[0] = (u8)(current_settings.magic >> 8);
-    temp_data[1] = (u8)(current_settings.magic & 0xFF);
-    if (!eeprom_write(SETTINGS_MAGIC_ADDR, temp_data, 2)) {
-        send_uart_message("Failed to save magic");
+    if (!settings_write_fields(SETTINGS_FIELD_ALL)) {
+        return 0;
+    }
+    settings_dirty = 0;
+    return 1;
+}
+
+// Record that a field changed; the write is deferred until the quiet period expires
+void settings_mark_dirty(u8 field) {
+    settings_dirty |= (u8)(1 << field);
+    settings_unseen |= (u8)(1 << field);
+    settings_changed_at = tick_now();
+}
+
+// Bitmask of fields changed since the previous call, for the display
+u8 settings_take_changes(void) {
+    u8 changes = settings_unseen;
+
+    settings_unseen = 0;
+    return changes;
+}
+
+// Called from the main loop: adopt a finished write, then flush coalesced
+// changes after a quiet period
+void settings_persist_poll(void) {
+    settings_write_poll();
+    if (!settings_dirty || settings_write_kind != SETTINGS_WRITE_NONE) {
+        return;
+    }
+    if (tick_elapsed(settings_changed_at, SETTINGS_PERSIST_QUIET_MS)) {
+        settings_persist_flush();
+    }
+}
+
+// Queue pending changes now (power-off, before reset, leaving TX etc.).
+// Follow with eeprom_sync() where the data must be on the device.
+__bit settings_persist_flush(void) {
+    if (!settings_dirty) {
+        return 1;
+    }
+    if (!settings_write_fields(settings_dirty)) {
+        settings_changed_at = tick_now(); // Retry after another quiet period
+        return 0;
+    }
+    settings_dirty = 0;
+    return 1;
+}
+
+// Queue the full current state as a new snapshot, retiring every journal
+// page once it lands
+__bit settings_compact(void) {
+    u16 seq = journal_seq + 1;
+    u8 slot = settings_active_slot ^ 1;
+
+    if (settings_write_kind != SETTINGS_WRITE_NONE) {
+        return 0; // One program in flight at a time
+    }
+    if (seq == SETTINGS_JOURNAL_SEQ_FREE) {
+        seq = 0;
+    }
+
+    send_uart_message("Compacting settings journal...");
+
+    settings_pack(settings_image, seq);
+    current_settings.crc = ((u16)settings_image[SETTINGS_OFS_CRC] << 8) | settings_image[SETTINGS_OFS_CRC + 1];
+
+    // Never touch the active slot: until this program completes it is the valid copy
+    settings_write_seq = seq;
+    if (!settings_write_submit(SETTINGS_WRITE_SNAPSHOT, SETTINGS_BASE_ADDR + (u16)slot * SETTINGS_SIZE,
+                               SETTINGS_SIZE, SETTINGS_FIELD_ALL)) {
+        send_uart_message("Failed to save settings");
         return 0;
     }
-    
-    // Save version
-    temp_data[0] = (u8)(current_settings.version >> 8);
-    temp_data[1] = (u8)(current_settings.version & 0xFF);
-    if (!eeprom_write(SETTINGS_VERSION_ADDR, temp_data, 2)) return 0;
-    
-    // Save frequency
-    temp_data[0] = (u8)(current_settings.frequency >> 8);
-    temp_data[1] = (u8)(current_settings.frequency & 0xFF);
-    if (!eeprom_write(SETTING_FREQUENCY_ADDR, temp_data, 2)) return 0;
-    
-    // Save volume
-    temp_data[0] = (u8)(current_settings.volume >> 8);
-    temp_data[1] = (u8)(current_settings.volume & 0xFF);
-    if (!eeprom_write(SETTING_VOLUME_ADDR, temp_data, 2)) return 0;
-    
-    // Save squelch
-    temp_data[0] = (u8)(current_settings.squelch >> 8);
-    temp_data[1] = (u8)(current_settings.squelch & 0xFF);
-    if (!eeprom_write(SETTING_SQUELCH_ADDR, temp_data, 2)) return 0;
-    
-    // Save power
-    temp_data[0] = (u8)(current_settings.power >> 8);
-    temp_data[1] = (u8)(current_settings.power & 0xFF);
-    if (!eeprom_write(SETTING_POWER_ADDR, temp_data, 2)) return 0;
-    
-    // Save backlight
-    temp_data[0] = (u8)(current_settings.backlight >> 8);
-    temp_data[1] = (u8)(current_settings.backlight & 0xFF);
-    if (!eeprom_write(SETTING_BACKLIGHT_ADDR, temp_data, 2)) return 0;
-    
-    // Save CTCSS
-    temp_data[0] = (u8)(current_settings.ctcss >> 8);
-    temp_data[1] = (u8)(current_settings.ctcss & 0xFF);
-    if (!eeprom_write(SETTING_CTCSS_ADDR, temp_data, 2)) return 0;
-    
-    // Save checksum
-    temp_data[0] = (u8)(current_settings.checksum >> 8);
-    temp_data[1] = (u8)(current_settings.checksum & 0xFF);
-    if (!eeprom_write(SETTINGS_CHECKSUM_ADDR, temp_data, 2)) return 0;
-    
-    send_uart_message("Settings saved successfully");
     return 1;
 }
 
@@ -152,32 +491,56 @@ void settings_load_defaults(void) {
     current_settings.power = DEFAULT_POWER;
     current_settings.backlight = DEFAULT_BACKLIGHT;
     current_settings.ctcss = DEFAULT_CTCSS;
-    current_settings.checksum = settings_calculate_checksum();
+    current_settings.crc = 0;
+}
+
+// Serialize current_settings into a packed, CRC-protected snapshot image
+void settings_pack(__xdata u8 *image, u16 sequence) {
+    u16 crc;
+    u8 i;
+
+    // Unused bytes stay in the erased state so later versions can extend the image
+    for (i = 0; i < SETTINGS_SIZE; i++) {
+        image[i] = 0xFF;
+    }
+
+    image[SETTINGS_OFS_MAGIC]         = (u8)(SETTINGS_MAGIC >> 8);
+    image[SETTINGS_OFS_MAGIC + 1]     = (u8)(SETTINGS_MAGIC & 0xFF);
+    image[SETTINGS_OFS_VERSION]       = SETTINGS_VERSION;
+    image[SETTINGS_OFS_SEQUENCE]      = (u8)(sequence >> 8);
+    image[SETTINGS_OFS_SEQUENCE + 1]  = (u8)(sequence & 0xFF);
+    freq_pack(&image[SETTINGS_OFS_FREQUENCY], current_settings.frequency);
+    image[SETTINGS_OFS_VOLUME]        = (u8)current_settings.volume;
+    image[SETTINGS_OFS_SQUELCH]       = (u8)current_settings.squelch;
+    image[SETTINGS_OFS_POWER]         = (u8)current_settings.power;
+    image[SETTINGS_OFS_BACKLIGHT]     = (u8)current_settings.backlight;
+    image[SETTINGS_OFS_CTCSS]         = (u8)current_settings.ctcss;
+
+    crc = settings_calculate_crc(image);
+    image[SETTINGS_OFS_CRC]     = (u8)(crc >> 8);
+    image[SETTINGS_OFS_CRC + 1] = (u8)(crc & 0xFF);
 }
 
-// Calculate simple checksum for settings validation
-u16 settings_calculate_checksum(void) {
-    u16 sum = 0;
-    sum += current_settings.magic;
-    sum += current_settings.version;
-    sum += current_settings.frequency;
-    sum += current_settings.volume;
-    sum += current_settings.squelch;
-    sum += current_settings.power;
-    sum += current_settings.backlight;
-    sum += current_settings.ctcss;
-    return sum;
+// Deserialize a page image (caller has already checked magic, version and CRC)
+void settings_unpack(const __xdata u8 *image) {
+    current_settings.magic     = ((u16)image[SETTINGS_OFS_MAGIC] << 8) | image[SETTINGS_OFS_MAGIC + 1];
+    current_settings.version   = image[SETTINGS_OFS_VERSION];
+    current_settings.frequency = freq_unpack(&image[SETTINGS_OFS_FREQUENCY]);
+    current_settings.volume    = image[SETTINGS_OFS_VOLUME];
+    current_settings.squelch   = image[SETTINGS_OFS_SQUELCH];
+    current_settings.power     = image[SETTINGS_OFS_POWER];
+    current_settings.backlight = image[SETTINGS_OFS_BACKLIGHT];
+    current_settings.ctcss     = image[SETTINGS_OFS_CTCSS];
+    current_settings.crc       = ((u16)image[SETTINGS_OFS_CRC] << 8) | image[SETTINGS_OFS_CRC + 1];
 }
 
-// Validate settings structure and ranges
+// CRC-16 over everything in the image except the CRC field itself
+u16 settings_calculate_crc(const __xdata u8 *image) {
+    return crc16(image, SETTINGS_OFS_CRC);
+}
+
+// Validate settings ranges (integrity is already covered by the image CRC)
 __bit settings_validate(void) {
-    // Check checksum
-    u16 calculated_checksum = settings_calculate_checksum();
-    if (current_settings.checksum != calculated_checksum) {
-        send_uart_message("Checksum mismatch");
-        return 0;
-    }
-    
     // Validate individual settings
     if (!settings_is_valid_frequency(current_settings.frequency)) {
         send_uart_message("Invalid frequency");
@@ -213,13 +576,14 @@ __bit settings_validate(void) {
 }
 
 // Individual setting accessors
-u16 settings_get_frequency(void) {
+freq_t settings_get_frequency(void) {
     return current_settings.frequency;
 }
 
-void settings_set_frequency(u16 freq_khz) {
-    if (settings_is_valid_frequency(freq_khz)) {
-        current_settings.frequency = freq_khz;
+void settings_set_frequency(freq_t freq) {
+    if (settings_is_valid_frequency(freq)) {
+        current_settings.frequency = freq;
+        settings_mark_dirty(SETTINGS_FIELD_FREQUENCY);
     }
 }
 
@@ -230,6 +594,7 @@ u8 settings_get_volume(void) {
 void settings_set_volume(u8 volume) {
     if (settings_is_valid_volume(volume)) {
         current_settings.volume = (u16)volume;
+        settings_mark_dirty(SETTINGS_FIELD_VOLUME);
     }
 }
 
@@ -240,6 +605,7 @@ u8 settings_get_squelch(void) {
 void settings_set_squelch(u8 squelch) {
     if (settings_is_valid_squelch(squelch)) {
         current_settings.squelch = (u16)squelch;
+        settings_mark_dirty(SETTINGS_FIELD_SQUELCH);
     }
 }
 
@@ -250,6 +616,7 @@ u8 settings_get_power(void) {
 void settings_set_power(u8 power) {
     if (settings_is_valid_power(power)) {
         current_settings.power = (u16)power;
+        settings_mark_dirty(SETTINGS_FIELD_POWER);
     }
 }
 
@@ -260,6 +627,7 @@ u8 settings_get_backlight(void) {
 void settings_set_backlight(u8 seconds) {
     if (settings_is_valid_backlight(seconds)) {
         current_settings.backlight = (u16)seconds;
+        settings_mark_dirty(SETTINGS_FIELD_BACKLIGHT);
     }
 }
 
@@ -270,12 +638,13 @@ u8 settings_get_ctcss(void) {
 void settings_set_ctcss(u8 tone_index) {
     if (settings_is_valid_ctcss(tone_index)) {
         current_settings.ctcss = (u16)tone_index;
+        settings_mark_dirty(SETTINGS_FIELD_CTCSS);
     }
 }
 
 // Settings validation helpers
-__bit settings_is_valid_frequency(u16 freq_khz) {
-    return (freq_khz >= FREQ_MIN && freq_khz <= FREQ_MAX);
+__bit settings_is_valid_frequency(freq_t freq) {
+    return (freq >= FREQ_MIN && freq <= FREQ_MAX);
 }
 
 __bit settings_is_valid_volume(u8 volume) {
@@ -0,0 +1,73 @@
+#include "textfield.h"
+
+__xdata u16 textfield_cells_drawn;
+
+// New contents of the field being set, padded to its length
+static __xdata char textfield_line[TEXTFIELD_MAX_CELLS];
+
+void textfield_init(textfield_t __xdata *field, u8 x, u8 y, u8 length, u8 font, u16 fg, u16 bg) {
+    field->x = x;
+    field->y = y;
+    field->length = (length > TEXTFIELD_MAX_CELLS) ? TEXTFIELD_MAX_CELLS : length;
+    field->font = font;
+    field->fg = fg;
+    field->bg = bg;
+    textfield_invalidate(field);
+}
+
+// Forget what is on screen, e.g. after a clear or a menu drew over the field.
+// The next textfield_set() repaints every cell.
+void textfield_invalidate(textfield_t __xdata *field) {
+    for (u8 i = 0; i < TEXTFIELD_MAX_CELLS; i++) {
+        field->shown[i] = 0;
+    }
+}
+
+// New colours apply to every cell, so a change repaints the whole field
+void textfield_set_colors(textfield_t __xdata *field, u16 fg, u16 bg) {
+    if (fg != field->fg || bg != field->bg) {
+        field->fg = fg;
+        field->bg = bg;
+        textfield_invalidate(field);
+    }
+}
+
+// Show text left aligned, padded with spaces and cut to the field length.
+// Non-printable characters show as spaces. Each run of consecutive changed
+// cells is drawn through one LCD window; returns the number of cells drawn.
+u8 textfield_set(textfield_t __xdata *field, const char *text) {
+    u8 advance = font_cell_advance(field->font);
+    u8 length = field->length;
+    u8 drawn = 0;
+    u8 start;
+    u8 i;
+    char c;
+
+    for (i = 0; i < length; i++) {
+        c = *text;
+        if (c) {
+            text++;
+        }
+        textfield_line[i] = (c >= 0x20 && c <= 0x7E) ? c : ' ';
+    }
+
+    i = 0;
+    while (i < length) {
+        if (textfield_line[i] == field->shown[i]) {
+            i++;
+            continue;
+        }
+
+        start = i;
+        while (i < length && textfield_line[i] != field->shown[i]) {
+            field->shown[i] = textfield_line[i];
+            i++;
+        }
+        font_draw_cells(field->x + start * advance, field->y, &textfield_line[start],
+                        i - start, field->font, field->fg, field->bg);
+        drawn += i - start;
+    }
+
+    textfield_cells_drawn += drawn;
+    return drawn;
+}
@@ -0,0 +1,112 @@
+#include "tick.h"
+#include "watchdog.h"
+
+// Milliseconds since timer_init(), advanced only by the ISR
+static volatile u32 tick_ms;
+
+// Ticks until the next watchdog supervisor pass
+static u8 tick_watchdog_countdown = WATCHDOG_FEED_MS;
+
+// Software timer pool
+typedef struct {
+    u32 deadline;       // tick_ms value at which the timer fires
+    u16 period;         // Re-arm interval for periodic timers, 0 for one-shot
+    u8 active;
+} tick_timer_t;
+
+static __xdata tick_timer_t tick_timers[TICK_TIMERS];
+
+void tick_isr(void) __interrupt(1) {
+    // Mode 1 has no auto-reload: reload high byte last so TL0 can't carry into a stale TH0
+    TL0 = TICK_RELOAD_L;
+    TH0 = TICK_RELOAD_H;
+    tick_ms++;
+
+    if (--tick_watchdog_countdown == 0) {
+        tick_watchdog_countdown = WATCHDOG_FEED_MS;
+        watchdog_supervise();
+    }
+}
+
+// Read the 32-bit counter without the ISR changing it halfway through
+u32 tick_now(void) {
+    u32 now;
+    __bit et0 = ET0;
+
+    ET0 = 0;
+    now = tick_ms;
+    ET0 = et0;
+    return now;
+}
+
+// Milliseconds plus the counts Timer0 has advanced into the current one.
+// With ET0 masked a pending overflow (TF0 set) can't be serviced yet; report
+// the start of the next millisecond, since the ISR's reload discards the
+// counts Timer0 makes between overflow and reload anyway.
+u32 tick_now_counts(void) {
+    u32 ms;
+    u16 counts;
+    u8 high, low;
+    __bit et0 = ET0;
+
+    ET0 = 0;
+    do {
+        high = TH0;
+        low = TL0;
+    } while (high != TH0);
+    ms = tick_ms;
+    if (TF0) {
+        ms++;
+        counts = 0;
+    } else {
+        counts = (((u16)high << 8) | low) - TICK_RELOAD;
+    }
+    ET0 = et0;
+
+    return ms * TICK_COUNTS_PER_MS + counts;
+}
+
+// Non-blocking: has at least ms passed since the tick_now() value in since?
+__bit tick_elapsed(u32 since, u32 ms) {
+    return (tick_now() - since) >= ms;
+}
+
+// Returns a timer handle, or TICK_TIMER_NONE if the pool is exhausted
+u8 tick_timer_start(u16 ms, __bit periodic) {
+    for (u8 i = 0; i < TICK_TIMERS; i++) {
+        if (!tick_timers[i].active) {
+            tick_timers[i].deadline = tick_now() + ms;
+            tick_timers[i].period = periodic ? ms : 0;
+            tick_timers[i].active = 1;
+            return i;
+        }
+    }
+    return TICK_TIMER_NONE;
+}
+
+// Returns 1 once per expiry. Periodic timers re-arm from their deadline so
+// they don't drift when polled late; one-shot timers free their slot.
+__bit tick_timer_expired(u8 timer) {
+    tick_timer_t __xdata *t;
+
+    if (timer >= TICK_TIMERS || !tick_timers[timer].active) {
+        return 0;
+    }
+    t = &tick_timers[timer];
+    if ((i32)(tick_now() - t->deadline) < 0) {
+        return 0;
+    }
+
+    if (t->period) {
+        t->deadline += t->period;
+    } else {
+        t->active = 0;
+    }
+    return 1;
+}
+
+void tick_timer_stop(u8 timer) {
+    if (timer < TICK_TIMERS) {
+        tick_timers[timer].active = 0;
+    }
+}
@@ -1,15 +1,21 @@
 #include "uart.h"
+#include "event.h"
 
-// Global buffers for reception (add these to your global variables)
+// Global buffers for reception. Write indices belong to the producer (poll
+// or ISR), read indices to the consumer; both run free and are masked on use.
 u8 __xdata uart_pr_rx_buffer[UART_RX_BUFFER_SIZE];
-u8 uart_pr_rx_write_idx = 0;
-u8 uart_pr_rx_read_idx = 0;
-u8 uart_pr_rx_count = 0;
+volatile u8 uart_pr_rx_write_idx = 0;
+volatile u8 uart_pr_rx_read_idx = 0;
 
 u8 __xdata uart_bt_rx_buffer[UART_BT_RX_BUFFER_SIZE];
-u8 uart_bt_rx_write_idx = 0;
-u8 uart_bt_rx_read_idx = 0;
-u8 uart_bt_rx_count = 0;
+volatile u8 uart_bt_rx_write_idx = 0;
+volatile u8 uart_bt_rx_read_idx = 0;
+
+// Bytes dropped because a receive ring was full
+volatile u8 uart_rx_overflows = 0;
+
+// Set by uart_bt_isr when it takes the TX complete flag
+static volatile __bit uart_bt_tx_done;
 
 
 //=================================================
@@ -57,22 +63,19 @@ void uart_pr_send_byte(const u8 byte) {
 
 // Check for received data on Programming UART
 u8 uart_pr_data_available(void) {
-    return uart_pr_rx_count;
+    return (u8)(uart_pr_rx_write_idx - uart_pr_rx_read_idx);
 }
 
 // Non-blocking receive function for Programming UART
 u8 uart_pr_try_receive_byte(u8 *data) {
-    if (uart_pr_rx_count == 0) {
+    u8 read_idx = uart_pr_rx_read_idx;
+
+    if (read_idx == uart_pr_rx_write_idx) {
         return 0;  // No data available
     }
     
-    EA = 0;  // Disable interrupts
-    
-    *data = uart_pr_rx_buffer[uart_pr_rx_read_idx];
-    uart_pr_rx_read_idx = (uart_pr_rx_read_idx + 1) % UART_RX_BUFFER_SIZE;
-    uart_pr_rx_count--;
-    
-    EA = 1;  // Re-enable interrupts
+    *data = uart_pr_rx_buffer[read_idx & (UART_RX_BUFFER_SIZE - 1)];
+    uart_pr_rx_read_idx = read_idx + 1;  // Release the slot after copying
     
     return 1;  // Data received successfully
 }
@@ -82,15 +85,7 @@ u8 uart_pr_receive_byte(void) {
     u8 data;
     
     // Wait for data
-    while (uart_pr_rx_count == 0);
-    
-    EA = 0;  // Disable interrupts
-    
-    data = uart_pr_rx_buffer[uart_pr_rx_read_idx];
-    uart_pr_rx_read_idx = (uart_pr_rx_read_idx + 1) % UART_RX_BUFFER_SIZE;
-    uart_pr_rx_count--;
-    
-    EA = 1;  // Re-enable interrupts
+    while (!uart_pr_try_receive_byte(&data));
     
     return data;
 }
@@ -101,16 +96,14 @@ void uart_pr_check_reception(void) {
     if (EXA1 & 0x01) {
         // Data received - read from EXA2
         u8 received_byte = EXA2;
+        u8 write_idx = uart_pr_rx_write_idx;
         
-        // Store in circular buffer
-        uart_pr_rx_buffer[uart_pr_rx_write_idx] = received_byte;
-        uart_pr_rx_write_idx = (uart_pr_rx_write_idx + 1) % UART_RX_BUFFER_SIZE;
-        
-        if (uart_pr_rx_count < UART_RX_BUFFER_SIZE) {
-            uart_pr_rx_count++;
+        // Store in circular buffer; on overflow keep the older bytes
+        if ((u8)(write_idx - uart_pr_rx_read_idx) < UART_RX_BUFFER_SIZE) {
+            uart_pr_rx_buffer[write_idx & (UART_RX_BUFFER_SIZE - 1)] = received_byte;
+            uart_pr_rx_write_idx = write_idx + 1;
         } else {
-            // Buffer overflow - advance read pointer
-            uart_pr_rx_read_idx = (uart_pr_rx_read_idx + 1) % UART_RX_BUFFER_SIZE;
+            uart_rx_overflows++;
         }
         
         // Clear receive flag (bit 0 of EXA1)
@@ -139,14 +132,19 @@ void uart_bt_init(void) {
     IP |= 0x10;
 }
 
+// Receive through uart_bt_isr and announce bytes on the event ring. Only for
+// firmwares that drain the ring; otherwise it would just fill and overflow.
+void uart_bt_rx_enable(void) {
+    EUART = 1;
+}
+
 void uart_bt_send_byte(const u8 byte) {
-    u8 status;
+    uart_bt_tx_done = 0;
     SBUF = byte;
 
-    // Wait for transmission to complete (polling method)
-    do {
-        status = SCON;
-    } while ((status & 0x02) == 0);  // Wait for TX complete flag (bit 1)
+    // Wait for transmission to complete: the ISR takes the TX complete flag
+    // when interrupts are on, otherwise poll it (bit 1)
+    while (!uart_bt_tx_done && (SCON & 0x02) == 0);
     
     // Clear transmit complete flag
     SCON &= 0xFD;  // Clear bit 1 (TX complete flag)
@@ -154,22 +152,19 @@ void uart_bt_send_byte(const u8 byte) {
 
 // Check for received data on Bluetooth UART
 u8 uart_bt_data_available(void) {
-    return uart_bt_rx_count;
+    return (u8)(uart_bt_rx_write_idx - uart_bt_rx_read_idx);
 }
 
 // Non-blocking receive function for Bluetooth UART
 u8 uart_bt_try_receive_byte(u8 *data) {
-    if (uart_bt_rx_count == 0) {
+    u8 read_idx = uart_bt_rx_read_idx;
+
+    if (read_idx == uart_bt_rx_write_idx) {
         return 0;  // No data available
     }
     
-    EA = 0;  // Disable interrupts
-    
-    *data = uart_bt_rx_buffer[uart_bt_rx_read_idx];
-    uart_bt_rx_read_idx = (uart_bt_rx_read_idx + 1) % UART_BT_RX_BUFFER_SIZE;
-    uart_bt_rx_count--;
-    
-    EA = 1;  // Re-enable interrupts
+    *data = uart_bt_rx_buffer[read_idx & (UART_BT_RX_BUFFER_SIZE - 1)];
+    uart_bt_rx_read_idx = read_idx + 1;  // Release the slot after copying
     
     return 1;  // Data received successfully
 }
@@ -179,59 +174,70 @@ u8 uart_bt_receive_byte(void) {
     u8 data;
     
     // Wait for data
-    while (uart_bt_rx_count == 0);
-    
-    EA = 0;  // Disable interrupts
-    
-    data = uart_bt_rx_buffer[uart_bt_rx_read_idx];
-    uart_bt_rx_read_idx = (uart_bt_rx_read_idx + 1) % UART_BT_RX_BUFFER_SIZE;
-    uart_bt_rx_count--;
-    
-    EA = 1;  // Re-enable interrupts
+    while (!uart_bt_try_receive_byte(&data));
     
     return data;
 }
 
-// Check for Bluetooth UART reception (call this in main loop)
-void uart_bt_check_reception(void) {
+// Move a received byte from SBUF into the ring. Runs from the serial ISR;
+// uart_bt_check_reception() can still call it when polling.
+static __bit uart_bt_receive_pending(void) {
+    u8 received_byte;
+    u8 write_idx;
+
     // Check if receive flag is set (bit 0 of SCON)
-    if (SCON & 0x01) {
-        // Data received - read from SBUF
-        u8 received_byte = SBUF;
-        
-        // Store in circular buffer
-        uart_bt_rx_buffer[uart_bt_rx_write_idx] = received_byte;
-        uart_bt_rx_write_idx = (uart_bt_rx_write_idx + 1) % UART_BT_RX_BUFFER_SIZE;
-        
-        if (uart_bt_rx_count < UART_BT_RX_BUFFER_SIZE) {
-            uart_bt_rx_count++;
-        } else {
-            // Buffer overflow - advance read pointer
-            uart_bt_rx_read_idx = (uart_bt_rx_read_idx + 1) % UART_BT_RX_BUFFER_SIZE;
-        }
-        
-        // Clear receive flag (bit 0 of SCON)
-        SCON &= 0xFE;
+    if (!(SCON & 0x01)) {
+        return 0;
+    }
+
+    received_byte = SBUF;
+    write_idx = uart_bt_rx_write_idx;
+
+    // Store in circular buffer; on overflow keep the older bytes
+    if ((u8)(write_idx - uart_bt_rx_read_idx) < UART_BT_RX_BUFFER_SIZE) {
+        uart_bt_rx_buffer[write_idx & (UART_BT_RX_BUFFER_SIZE - 1)] = received_byte;
+        uart_bt_rx_write_idx = write_idx + 1;
+    } else {
+        uart_rx_overflows++;
     }
+
+    // Clear receive flag (bit 0 of SCON)
+    SCON &= 0xFE;
+    return 1;
+}
+
+// Serial interrupt. TI must be cleared here too or it would re-enter
+// until uart_bt_send_byte noticed it, so hand it over as uart_bt_tx_done.
+void uart_bt_isr(void) __interrupt(4) {
+    if (SCON & 0x02) {
+        SCON &= 0xFD;
+        uart_bt_tx_done = 1;
+    }
+    if (uart_bt_receive_pending()) {
+        event_post(EVENT_UART_RX, UART_PORT_BT);
+    }
+}
+
+// Check for Bluetooth UART reception (polling fallback)
+void uart_bt_check_reception(void) {
+    __bit euart = EUART;
+
+    EUART = 0;
+    uart_bt_receive_pending();
+    EUART = euart;
 }
 
 // Utility Functions
 //==================
 
-// Flush Programming UART receive buffer
+// Flush Programming UART receive buffer (consumer side: only moves the read index)
 void uart_pr_flush_rx_buffer(void) {
-    EA = 0;
     uart_pr_rx_read_idx = uart_pr_rx_write_idx;
-    uart_pr_rx_count = 0;
-    EA = 1;
 }
 
-// Flush Bluetooth UART receive buffer
+// Flush Bluetooth UART receive buffer (consumer side: only moves the read index)
 void uart_bt_flush_rx_buffer(void) {
-    EA = 0;
     uart_bt_rx_read_idx = uart_bt_rx_write_idx;
-    uart_bt_rx_count = 0;
-    EA = 1;
 }
 
 // Send string via Programming UART
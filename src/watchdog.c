@@ -1,4 +1,21 @@
 #include "watchdog.h"
+#include "uart.h"
+
+typedef struct {
+    u16 timeout;            // ms allowed between check-ins
+    u16 remaining;          // ms left, counted down by the supervisor
+    volatile u8 checked_in; // Set by the client, taken by the supervisor
+    volatile u8 active;     // Written last on register, first on unregister
+} watchdog_client_t;
+
+static __xdata watchdog_client_t watchdog_clients[WATCHDOG_CLIENTS];
+
+volatile u8 watchdog_missed = WATCHDOG_CLIENT_NONE;
+
+static __bit watchdog_reported;
+
+// Client supervised alone while it holds the CPU, WATCHDOG_CLIENT_NONE otherwise
+static volatile u8 watchdog_owner = WATCHDOG_CLIENT_NONE;
 
 void watchdog_init(void)
 {
@@ -9,6 +26,9 @@ void watchdog_init(void)
     // These appear to be LCD-related but mechanism unclear
     exP04Mode = 3;  // P0.4 (LCDSCLK?) - mode 3 function unknown
     exP05Mode = 3;  // P0.5 (LCD_SDA?) - mode 3 function unknown
+
+    // Supervise the boot path from here on instead of feeding blindly
+    watchdog_register(WATCHDOG_CLIENT_BOOT, WATCHDOG_BOOT_MS);
 }
 
 void watchdog_reset(void)
@@ -31,3 +51,95 @@ void watchdog_config(void)
     IOHCON1 |= 2;
   
 }
+
+// The supervisor only reads a client once active is set, so fill it in first
+void watchdog_register(u8 client, u16 timeout_ms)
+{
+    if (client >= WATCHDOG_CLIENTS) {
+        return;
+    }
+    watchdog_clients[client].active = 0;
+    watchdog_clients[client].timeout = timeout_ms;
+    watchdog_clients[client].remaining = timeout_ms;
+    watchdog_clients[client].checked_in = 0;
+    watchdog_clients[client].active = 1;
+}
+
+void watchdog_unregister(u8 client)
+{
+    if (client < WATCHDOG_CLIENTS) {
+        watchdog_clients[client].active = 0;
+    }
+}
+
+// One byte store, so no masking against the supervisor is needed
+void watchdog_checkin(u8 client)
+{
+    if (client < WATCHDOG_CLIENTS) {
+        watchdog_clients[client].checked_in = 1;
+    }
+}
+
+// For foreground loops that legitimately own the CPU for a long time (clone
+// sessions) and so keep every scheduled task from running: only the claiming
+// client's deadline is supervised until watchdog_release()
+void watchdog_claim(u8 client)
+{
+    if (client < WATCHDOG_CLIENTS) {
+        watchdog_owner = client;
+    }
+}
+
+// The other clients were held up by the owner, not stuck: restart their
+// timeouts before they count again
+void watchdog_release(void)
+{
+    for (u8 i = 0; i < WATCHDOG_CLIENTS; i++) {
+        watchdog_clients[i].checked_in = 1;
+    }
+    watchdog_owner = WATCHDOG_CLIENT_NONE;
+}
+
+// Called from the tick ISR every WATCHDOG_FEED_MS
+void watchdog_supervise(void)
+{
+    watchdog_client_t __xdata *c;
+
+    if (watchdog_missed != WATCHDOG_CLIENT_NONE) {
+        return;  // Already starving the dog
+    }
+
+    for (u8 i = 0; i < WATCHDOG_CLIENTS; i++) {
+        c = &watchdog_clients[i];
+        if (!c->active || (watchdog_owner != WATCHDOG_CLIENT_NONE && i != watchdog_owner)) {
+            continue;
+        }
+        if (c->checked_in) {
+            c->checked_in = 0;
+            c->remaining = c->timeout;
+        } else if (c->remaining > WATCHDOG_FEED_MS) {
+            c->remaining -= WATCHDOG_FEED_MS;
+        } else {
+            // Record only: the UART is blocking and may be mid-frame in the
+            // foreground, so watchdog_report() prints it if the loop returns
+            watchdog_missed = i;
+            return;
+        }
+    }
+
+    watchdog_reset();
+}
+
+// Foreground side of a miss: print it once, before the hardware dog resets
+void watchdog_report(void)
+{
+    u8 client = watchdog_missed;
+
+    if (client == WATCHDOG_CLIENT_NONE || watchdog_reported) {
+        return;
+    }
+    watchdog_reported = 1;
+    uart_pr_send_string("WDT miss: task ");
+    uart_pr_send_byte('0' + client);
+    uart_pr_send_string("\r\n");
+}
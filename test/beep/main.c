@@ -45,6 +45,9 @@ void main(void) {
     send_uart_message("Beep tests completed successfully!");
     send_uart_message("=== BEEP TESTS COMPLETE ===");
 
+    // Setup is done: retire the boot client, the loop below feeds the dog by hand
+    watchdog_unregister(WATCHDOG_CLIENT_BOOT);
+
     // Simple loop
     while (1) {
         watchdog_reset();
@@ -0,0 +1,149 @@
+#include "H8.h"
+#include "delay.h"
+#include "watchdog.h"
+#include "hardware.h"
+#include "pwm.h"
+#include "uart.h"
+#include "lcd.h"
+#include "uart_test.h"
+#include "i2c.h"
+#include "eeprom.h"
+#include "channel.h"
+
+// Simple UART message function implementation
+void send_uart_message(char* message) {
+    uart_pr_send_string((u8*)message);
+    uart_pr_send_string((u8*)"\r\n");
+}
+
+void send_uart_number(u16 number) {
+    // Simple number to string conversion and send
+    char buffer[6];
+    u8 i = 0, j;
+    if (number == 0) {
+        uart_pr_send_byte('0');
+        return;
+    }
+    while (number > 0) {
+        buffer[i++] = '0' + (number % 10);
+        number /= 10;
+    }
+    for (j = i; j > 0; j--) {
+        uart_pr_send_byte(buffer[j-1]);
+    }
+}
+
+static __xdata channel_t test_channel;
+
+// Store a demo channel in a slot
+static void test_store_channel(u8 index, freq_t freq, char* name) {
+    u8 i;
+    test_channel.rx_freq = freq;
+    test_channel.tx_freq = freq;
+    test_channel.rx_tone = 0;
+    test_channel.tx_tone = 0;
+    test_channel.power = 4;
+    test_channel.bandwidth = 0;
+    test_channel.flags = 0;
+    for (i = 0; i < CHANNEL_NAME_LEN && name[i]; i++) {
+        test_channel.name[i] = name[i];
+    }
+    test_channel.name[i] = 0;
+
+    if (!channel_store(index, &test_channel)) {
+        send_uart_message("FAIL: channel store");
+        return;
+    }
+
+    // The programs are queued; drive the executor as the I2C task would
+    while (channel_write_status() == I2C_XFER_QUEUED) {
+        i2c_queue_run();
+    }
+    if (channel_write_status() != I2C_XFER_DONE) {
+        send_uart_message("FAIL: channel write");
+    }
+}
+
+static void test_show_stats(void) {
+    send_uart_message("Cache hits / misses:");
+    send_uart_number(channel_cache_hits);
+    uart_pr_send_byte('/');
+    send_uart_number(channel_cache_misses);
+    uart_pr_send_string((u8*)"\r\n");
+}
+
+void main(void) {
+    const __xdata channel_t *channel;
+    u8 index;
+    u8 step;
+
+    // Minimal hardware initialization
+    hardware_init();
+    timer_init();
+    pwm_init(0, 0xc);
+    watchdog_init();
+    watchdog_reset();
+    watchdog_config();
+    pwm_pin_setup();
+    delay_ms(1, 0x2c);
+    uart_pr_init();
+    uart_bt_init();
+    lcd_init();
+
+    delay_ms(6, 232);
+
+    send_uart_message("=== CHANNEL TEST FIRMWARE ===");
+    send_uart_message("Initializing I2C bus...");
+    i2c_init();
+
+    channel_init();
+
+    // Demo channels: unchanged records are skipped by the read-compare in channel_store
+    test_store_channel(0, FREQ_FROM_KHZ(446000) + FREQ_STEP_6K25, "PMR 1");     // 446.00625
+    test_store_channel(1, FREQ_FROM_KHZ(446000) + 3 * FREQ_STEP_6K25, "PMR 2"); // 446.01875
+    test_store_channel(2, FREQ_FROM_KHZ(446000) + 5 * FREQ_STEP_6K25, "PMR 3"); // 446.03125
+    test_store_channel(10, FREQ_FROM_KHZ(145500), "2M CALL");
+
+    send_uart_message("Occupied channels:");
+    send_uart_number(channel_count());
+    uart_pr_send_string((u8*)"\r\n");
+
+    // Browse forward twice around the list; after the first lap every step should hit RAM
+    channel_cache_invalidate();
+    channel_cache_hits = 0;
+    channel_cache_misses = 0;
+    index = CHANNEL_NONE;
+    for (step = 0; step < 8; step++) {
+        index = channel_next(index);
+        channel = channel_get(index);
+        if (channel) {
+            send_uart_number(index);
+            uart_pr_send_byte(' ');
+            send_uart_message((char*)channel->name);
+        }
+    }
+    test_show_stats();
+
+    // Browse backwards
+    for (step = 0; step < 4; step++) {
+        index = channel_prev(index);
+        channel = channel_get(index);
+        if (channel) {
+            send_uart_number(index);
+            uart_pr_send_byte(' ');
+            send_uart_message((char*)channel->name);
+        }
+    }
+    test_show_stats();
+
+    send_uart_message("=== CHANNEL TESTS COMPLETE ===");
+
+    // Setup is done: retire the boot client, the loop below feeds the dog by hand
+    watchdog_unregister(WATCHDOG_CLIENT_BOOT);
+
+    // Simple loop
+    while (1) {
+        watchdog_reset();
+        delay_ms(100, 0);
+    }
+}
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include "uart_test.h"
 #include "i2c.h"
 #include "eeprom.h"
+#include "font.h"
+#include "tick.h"
 
 // Simple UART message function implementation
 void send_uart_message(char* message) {
@@ -15,6 +17,148 @@ void send_uart_message(char* message) {
     uart_pr_send_string((u8*)"\r\n");
 }
 
+void send_uart_number(u16 number) {
+    // Simple number to string conversion and send
+    char buffer[6];
+    u8 i = 0, j;
+    if (number == 0) {
+        uart_pr_send_byte('0');
+        return;
+    }
+    while (number > 0) {
+        buffer[i++] = '0' + (number % 10);
+        number /= 10;
+    }
+    for (j = i; j > 0; j--) {
+        uart_pr_send_byte(buffer[j-1]);
+    }
+}
+
+// Scratch page at the top of the EEPROM, clear of settings and channels
+#define TEST_CACHE_ADDR 0x1FE0
+
+// Exercise the write-back cache: small writes merge in RAM, a rewrite of the
+// same bytes is skipped and the flush programs the page once. The page is
+// seeded with a known background first and read back from the device, not
+// the cache, so the check proves what the flush actually programmed.
+static void test_eeprom_cache(void) {
+    static __xdata u8 bytes[4];
+    static __xdata u8 page[EEPROM_PAGE_SIZE];
+    eeprom_cache_stats_t before;
+    __bit ok;
+    u8 i, expect;
+
+    for (i = 0; i < EEPROM_PAGE_SIZE; i++) {
+        page[i] = 0xA0 + i;
+    }
+    eeprom_program(TEST_CACHE_ADDR, page, EEPROM_PAGE_SIZE);
+    eeprom_cache_invalidate();
+    before.hits = eeprom_cache_stats.hits;
+    before.misses = eeprom_cache_stats.misses;
+    before.programs = eeprom_cache_stats.programs;
+    before.skipped = eeprom_cache_stats.skipped;
+
+    for (i = 0; i < 4; i++) {
+        bytes[i] = 0x30 + i;
+    }
+    eeprom_cache_write(TEST_CACHE_ADDR + 2, bytes, 4);
+    eeprom_cache_write(TEST_CACHE_ADDR + 20, bytes, 2);
+    eeprom_cache_write(TEST_CACHE_ADDR + 2, bytes, 4);
+    eeprom_cache_flush();
+
+    eeprom_cache_invalidate();
+    ok = eeprom_read(TEST_CACHE_ADDR, page, EEPROM_PAGE_SIZE);
+    for (i = 0; ok && i < EEPROM_PAGE_SIZE; i++) {
+        if (i >= 2 && i < 6) {
+            expect = 0x30 + i - 2;
+        } else if (i >= 20 && i < 22) {
+            expect = 0x30 + i - 20;
+        } else {
+            expect = 0xA0 + i;  // Untouched bytes keep the background
+        }
+        if (page[i] != expect) {
+            ok = 0;
+        }
+    }
+    send_uart_message(ok ? "PASS: flushed page read back" : "FAIL: flushed page read back");
+
+    // One load, two hits, one skipped rewrite, one page program
+    ok = eeprom_cache_stats.misses - before.misses == 1 &&
+         eeprom_cache_stats.hits - before.hits == 2 &&
+         eeprom_cache_stats.skipped - before.skipped == 1 &&
+         eeprom_cache_stats.programs - before.programs == 1;
+    send_uart_message(ok ? "PASS: cache counters" : "FAIL: cache counters");
+
+    send_uart_message("Hits / misses / programs / skipped:");
+    send_uart_number(eeprom_cache_stats.hits);
+    uart_pr_send_byte('/');
+    send_uart_number(eeprom_cache_stats.misses);
+    uart_pr_send_byte('/');
+    send_uart_number(eeprom_cache_stats.programs);
+    uart_pr_send_byte('/');
+    send_uart_number(eeprom_cache_stats.skipped);
+    uart_pr_send_string((u8*)"\r\n");
+}
+
+void send_uart_number_32(u32 number) {
+    char buffer[11];
+    u8 i = 0, j;
+    if (number == 0) {
+        uart_pr_send_byte('0');
+        return;
+    }
+    while (number > 0) {
+        buffer[i++] = '0' + (number % 10);
+        number /= 10;
+    }
+    for (j = i; j > 0; j--) {
+        uart_pr_send_byte(buffer[j-1]);
+    }
+}
+
+// Stand-in for screen_show(): clear the panel and draw a readout built from
+// the loaded bytes, so both boot paths end on the same first frame
+static void test_first_frame(const __xdata u8 *page) {
+    clear_area(0, 0, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1);
+    render_16x8_number(26, 60, ((u16)page[0] << 8) | page[1]);
+}
+
+static void report_boot_time(char *label, u32 counts, u16 transactions) {
+    uart_pr_send_string((u8*)label);
+    send_uart_number_32(counts);
+    uart_pr_send_string((u8*)" us to first frame, transactions: ");
+    send_uart_number(transactions);
+    uart_pr_send_string((u8*)"\r\n");
+}
+
+// Boot-time access to the hot pages (settings slots A/B, channel bitmap)
+// through to the first screen draw: three separate reads versus one
+// sequential prefetch served from RAM. Timer0 counts are microseconds at
+// the assumed 12 MHz clock.
+static void test_eeprom_prefetch(void) {
+    static __xdata u8 page[32];
+    u16 start;
+    u32 t0;
+
+    eeprom_cache_invalidate();
+    start = eeprom_transactions;
+    t0 = tick_now_counts();
+    eeprom_read(0x0100, page, 32);
+    eeprom_read(0x0120, page, 32);
+    eeprom_read(0x0140, page, 25);
+    test_first_frame(page);
+    report_boot_time("Piecemeal boot reads: ", tick_now_counts() - t0, eeprom_transactions - start);
+
+    start = eeprom_transactions;
+    t0 = tick_now_counts();
+    eeprom_cache_prefetch(0x0100, 3);
+    eeprom_cache_read(0x0100, page, 32);
+    eeprom_cache_read(0x0120, page, 32);
+    eeprom_cache_read(0x0140, page, 25);
+    test_first_frame(page);
+    report_boot_time("Prefetched boot reads: ", tick_now_counts() - t0, eeprom_transactions - start);
+}
+
 void main(void) {
     // Minimal hardware initialization
     hardware_init();
@@ -37,10 +181,16 @@ void main(void) {
     i2c_init();
     
     // Run only EEPROM tests
-    send_uart_message("EEPROM test would run here");
-    send_uart_message("Basic EEPROM read/write functionality");
+    send_uart_message("Write-back page cache...");
+    test_eeprom_cache();
+
+    send_uart_message("Boot prefetch...");
+    test_eeprom_prefetch();
     send_uart_message("=== EEPROM TESTS COMPLETE ===");
 
+    // Setup is done: retire the boot client, the loop below feeds the dog by hand
+    watchdog_unregister(WATCHDOG_CLIENT_BOOT);
+
     // Simple loop
     while (1) {
         watchdog_reset();
@@ -6,6 +6,8 @@
 #include "uart.h"
 #include "lcd.h"
 #include "font.h"
+#include "tick.h"
+#include "textfield.h"
 
 // Simple UART message function implementation
 void send_uart_message(char* message) {
@@ -13,6 +15,125 @@ void send_uart_message(char* message) {
     uart_pr_send_string((u8*)"\r\n");
 }
 
+void send_uart_number_32(u32 number) {
+    // Simple 32-bit number to string conversion
+    char buffer[11];
+    u8 i = 0, j;
+    if (number == 0) {
+        uart_pr_send_byte('0');
+        return;
+    }
+    while (number > 0) {
+        buffer[i++] = '0' + (number % 10);
+        number /= 10;
+    }
+    for (j = i; j > 0; j--) {
+        uart_pr_send_byte(buffer[j-1]);
+    }
+}
+
+// Reference rasterizer: the per-pixel shifted-mask loop the font code used
+// before the run tables, kept here as the benchmark baseline
+static void reference_16x8_glyph(u8 x, u8 y, const __code u8 *glyph) {
+    lcd_set_window(x, y, x + 15, y + 7);
+    for (u8 row = 0; row < 8; row++) {
+        u16 row_data = ((u16)glyph[row * 2] << 8) | glyph[row * 2 + 1];
+        for (u8 col = 0; col < 16; col++) {
+            if (row_data & (0x8000 >> col)) {
+                lcd_send_data(0xFF);
+                lcd_send_data(0xFF);
+            } else {
+                lcd_send_data(0x00);
+                lcd_send_data(0x00);
+            }
+        }
+    }
+}
+
+#define GLYPH_BENCH_COUNT 50
+
+// Glyph table from font.c
+extern __code u8 font_16x8_data[95][16];
+
+// Timer0 counts one per machine cycle (Fsys/12), so counts / glyph is the
+// per-glyph cycle cost including the LCD transfers
+static void report_glyph_cycles(char* label, u32 counts) {
+    uart_pr_send_string((u8*)label);
+    send_uart_number_32(counts / GLYPH_BENCH_COUNT);
+    uart_pr_send_string((u8*)" cycles/glyph\r\n");
+}
+
+// Sparse ('.'), typical ('A') and dense ('M') glyphs through the run-table
+// rasterizer, then 'A' through the per-pixel reference
+void benchmark_16x8_glyphs(void) {
+    static __code const char sample[] = ".AM";
+    u32 start;
+    u8 i, s;
+
+    send_uart_message("=== 16x8 glyph benchmark ===");
+    for (s = 0; s < 3; s++) {
+        start = tick_now_counts();
+        for (i = 0; i < GLYPH_BENCH_COUNT; i++) {
+            render_16x8_char(5, 5, sample[s]);
+        }
+        uart_pr_send_byte(sample[s]);
+        report_glyph_cycles(" run tables: ", tick_now_counts() - start);
+    }
+
+    start = tick_now_counts();
+    for (i = 0; i < GLYPH_BENCH_COUNT; i++) {
+        reference_16x8_glyph(5, 5, &font_16x8_data['A' - 0x20][0]);
+    }
+    report_glyph_cycles("A per-pixel: ", tick_now_counts() - start);
+
+    // 2x scaled digits, as used for the frequency display: five glyphs per call
+    start = tick_now_counts();
+    for (i = 0; i < GLYPH_BENCH_COUNT / 5; i++) {
+        render_32x32_number(0, 40, 43962);
+    }
+    report_glyph_cycles("32x32 digit: ", tick_now_counts() - start);
+}
+
+// Frequency readout stepped 25 kHz at a time: the text field should repaint
+// two or three cells per step where the plain string redraws all nine
+void test_16x8_textfield(void) {
+    static __code const char * __code steps[] = {
+        "446.00000", "446.02500", "446.05000", "446.07500", "446.10000"
+    };
+    static __xdata textfield_t field;
+    u32 start;
+    u8 s, drawn;
+
+    send_uart_message("=== 16x8 text field ===");
+    textfield_init(&field, 26, 60, 9, FONT_16X8, FONT_COLOR_WHITE, FONT_COLOR_BLACK);
+
+    drawn = textfield_set(&field, steps[0]);
+    uart_pr_send_string((u8*)"first set, cells: ");
+    send_uart_number_32(drawn);
+    uart_pr_send_string((u8*)"\r\n");
+
+    for (s = 1; s < 5; s++) {
+        start = tick_now_counts();
+        drawn = textfield_set(&field, steps[s]);
+        uart_pr_send_string((u8*)steps[s]);
+        uart_pr_send_string((u8*)" cells: ");
+        send_uart_number_32(drawn);
+        uart_pr_send_string((u8*)" cycles: ");
+        send_uart_number_32(tick_now_counts() - start);
+        uart_pr_send_string((u8*)"\r\n");
+    }
+
+    // Same value again must not touch the LCD
+    drawn = textfield_set(&field, steps[4]);
+    send_uart_message(drawn ? "FAIL: unchanged value redrawn" : "unchanged value: 0 cells");
+
+    start = tick_now_counts();
+    render_16x8_string(26, 60, steps[4]);
+    uart_pr_send_string((u8*)"full string cycles: ");
+    send_uart_number_32(tick_now_counts() - start);
+    uart_pr_send_string((u8*)"\r\n");
+}
+
 // Test 16x8 font rendering
 void test_16x8_font(void) {
     send_uart_message("=== Testing 16x8 Font ===");
@@ -87,12 +208,17 @@ void main(void) {
     
     // Run font tests
     test_16x8_font();
+    benchmark_16x8_glyphs();
+    test_16x8_textfield();
     
     send_uart_message("=== ALL TESTS COMPLETE ===");
     send_uart_message("Font test running in continuous loop");
     
     // Main loop
     u16 counter = 0;
+    // Setup is done: retire the boot client, the loop below feeds the dog by hand
+    watchdog_unregister(WATCHDOG_CLIENT_BOOT);
+
     while (1) {
         watchdog_reset();
         delay_ms(0, 100); // 100ms delay
@@ -70,6 +70,9 @@ void main(void) {
     send_uart_message("");
     send_uart_message("=== KEYPAD TEST COMPLETE ===");
 
+    // Setup is done: retire the boot client, the loop below feeds the dog by hand
+    watchdog_unregister(WATCHDOG_CLIENT_BOOT);
+
     // Simple loop for any additional manual testing
     while (1) {
         watchdog_reset();
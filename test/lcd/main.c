@@ -6,6 +6,7 @@
 #include "uart.h"
 #include "lcd.h"
 #include "font.h"
+#include "tick.h"
 
 // Simple UART message function implementation
 void send_uart_message(char* message) {
@@ -13,6 +14,104 @@ void send_uart_message(char* message) {
     uart_pr_send_string((u8*)"\r\n");
 }
 
+void send_uart_number_32(u32 number) {
+    // Simple 32-bit number to string conversion
+    char buffer[11];
+    u8 i = 0, j;
+    if (number == 0) {
+        uart_pr_send_byte('0');
+        return;
+    }
+    while (number > 0) {
+        buffer[i++] = '0' + (number % 10);
+        number /= 10;
+    }
+    for (j = i; j > 0; j--) {
+        uart_pr_send_byte(buffer[j-1]);
+    }
+}
+
+static void report_fill_time(char* label, u32 counts) {
+    send_uart_message(label);
+    uart_pr_send_string((u8*)"  full screen us: ");
+    send_uart_number_32(counts);
+    // 20480 pixels; x1000 for ns keeps three digits of the per-pixel cost
+    uart_pr_send_string((u8*)"\r\n  per pixel ns: ");
+    send_uart_number_32(counts * 1000 / (160UL * 128));
+    uart_pr_send_string((u8*)"\r\n");
+}
+
+// Full-screen black clear through the per-byte lcd_send_data() path versus
+// the lcd_fill_run() loop. Timer counts are microseconds at 12 MHz.
+void benchmark_fill(void) {
+    u32 start;
+    u32 per_call;
+    u32 run;
+    u8 row, col;
+
+    send_uart_message("--- FILL BENCHMARK ---");
+
+    lcd_set_window(0, 0, 159, 127);
+    start = tick_now_counts();
+    for (row = 0; row < 128; row++) {
+        for (col = 0; col < 160; col++) {
+            lcd_send_data(0x00);
+            lcd_send_data(0x00);
+        }
+    }
+    per_call = tick_now_counts() - start;
+
+    lcd_set_window(0, 0, 159, 127);
+    start = tick_now_counts();
+    lcd_fill_run(0x0000, 160 * 128);
+    run = tick_now_counts() - start;
+
+    report_fill_time("lcd_send_data x2 per pixel:", per_call);
+    report_fill_time("lcd_fill_run:", run);
+    send_uart_message("--- END BENCHMARK ---");
+}
+
+// Twelve 12x8 glyph-sized cells along one text row, as a 16x8 string draws
+// them: every call shares the rows, so the cache drops RASET each time.
+// The uncached pass invalidates before each window, which is what every
+// call cost before the cache. Counts are microseconds at 12 MHz.
+#define WINDOW_BENCH_CELLS 12
+
+static u32 window_bench_pass(u8 cached) {
+    u32 start = tick_now_counts();
+    u8 i;
+
+    for (i = 0; i < WINDOW_BENCH_CELLS; i++) {
+        if (!cached) {
+            lcd_window_invalidate();
+        }
+        lcd_set_window(4 + i * 12, 60, 15 + i * 12, 67);
+        lcd_fill_run(0x07E0, 12 * 8);
+    }
+    return tick_now_counts() - start;
+}
+
+void benchmark_window(void) {
+    u16 skipped;
+
+    send_uart_message("--- WINDOW CACHE BENCHMARK ---");
+    window_bench_pass(0);   // Warm up: leaves the cache holding the last cell
+
+    uart_pr_send_string((u8*)"uncached us per cell: ");
+    send_uart_number_32(window_bench_pass(0) / WINDOW_BENCH_CELLS);
+    uart_pr_send_string((u8*)"\r\n");
+
+    skipped = lcd_window_cmds_skipped;
+    uart_pr_send_string((u8*)"cached us per cell: ");
+    send_uart_number_32(window_bench_pass(1) / WINDOW_BENCH_CELLS);
+    uart_pr_send_string((u8*)"\r\ncommands skipped: ");
+    send_uart_number_32((u16)(lcd_window_cmds_skipped - skipped));
+    uart_pr_send_string((u8*)"\r\n");
+
+    clear_area(0, 60, 159, 67);
+    send_uart_message("--- END BENCHMARK ---");
+}
+
 // Fill pattern based on working example structure
 void fill_pattern_like_working(u8 fill_hi, u8 fill_lo, char* test_name) {
     u8 row, col;
@@ -196,11 +295,22 @@ void main(void) {
     send_uart_message("Final test: Black clear");
     fill_pattern_like_working(0x00, 0x00, "FINAL_BLACK_CLEAR");
     
+    // Test 7: Fill primitive benchmark (leaves the screen black)
+    send_uart_message("Test 7: Fill benchmark");
+    benchmark_fill();
+    
+    // Test 8: Window cache benchmark (leaves the screen black)
+    send_uart_message("Test 8: Window cache benchmark");
+    benchmark_window();
+    
     send_uart_message("=== ALL LCD TESTS COMPLETE ===");
     send_uart_message("Monitor display for visual changes during tests");
     
     // Main loop with periodic testing
     u16 test_counter = 0;
+    // Setup is done: retire the boot client, the loop below feeds the dog by hand
+    watchdog_unregister(WATCHDOG_CLIENT_BOOT);
+
     while (1) {
         watchdog_reset();
         delay_ms(0, 100); // 100ms delay
@@ -37,6 +37,9 @@ void main(void) {
     send_uart_message("Testing Bluetooth LED");
     send_uart_message("=== LED TESTS COMPLETE ===");
 
+    // Setup is done: retire the boot client, the loop below feeds the dog by hand
+    watchdog_unregister(WATCHDOG_CLIENT_BOOT);
+
     // Simple loop
     while (1) {
         watchdog_reset();
@@ -132,6 +132,9 @@ void main(void) {
     render_16x16_string(16, 32, "H8 MENU");
     render_16x16_string(16, 64, "TEST");
 
+    // Setup is done: retire the boot client, the loop below feeds the dog by hand
+    watchdog_unregister(WATCHDOG_CLIENT_BOOT);
+
     while (1) {
         watchdog_reset();
         
@@ -165,6 +168,9 @@ void main(void) {
         
         key_debounce_timer++;
         
+        // Write coalesced settings changes once editing has settled
+        settings_persist_poll();
+        
         // Update display
         if (menu_mode && menu_display_dirty) {
             menu_update_display();
@@ -58,11 +58,7 @@ void main(void) {
     
     // Test basic EEPROM communication
     send_uart_message("Testing EEPROM...");
-    EA = 0;
-    i2c_start();
-    __bit eeprom_present = i2c_send(0xA0);
-    i2c_stop();
-    EA = 1;
+    __bit eeprom_present = i2c_probe(0xA0);
     
     if (eeprom_present) {
         send_uart_message("EEPROM detected - initializing menu system");
@@ -76,11 +72,12 @@ void main(void) {
     
     // Initialize AT1846S with current settings
     send_uart_message("Applying saved settings to radio...");
-    u16 freq = settings_get_frequency();
+    freq_t freq = settings_get_frequency();
+    u16 freq_mhz, freq_khz;
     u8 vol = settings_get_volume();
     u8 sql = settings_get_squelch();
     
-    at1846s_set_frequency((u32)freq);
+    at1846s_set_frequency_raw(freq);
     at1846s_set_volume(vol);
     at1846s_set_squelch(sql);
     
@@ -99,7 +96,8 @@ void main(void) {
     
     // Show current frequency
     render_16x16_string(8, 80, "Freq:");
-    render_16x16_number(80, 80, freq);
+    freq_split(freq, &freq_mhz, &freq_khz);
+    render_16x16_number(80, 80, freq_mhz);
 
     u8 last_key = 0;  // Track last key to prevent repeats
 
@@ -141,7 +139,8 @@ void main(void) {
                     // Update frequency display in normal mode
                     if (current_key >= KEY_1 && current_key <= KEY_9) {
                         clear_area(80, 80, 159, 95);
-                        render_16x16_number(80, 80, settings_get_frequency());
+                        freq_split(settings_get_frequency(), &freq_mhz, &freq_khz);
+                        render_16x16_number(80, 80, freq_mhz);
                     }
                 }
             }
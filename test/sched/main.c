@@ -0,0 +1,108 @@
+#include "H8.h"
+#include "delay.h"
+#include "watchdog.h"
+#include "hardware.h"
+#include "pwm.h"
+#include "uart.h"
+#include "lcd.h"
+#include "uart_test.h"
+#include "tick.h"
+#include "sched.h"
+
+// Simple UART message function implementation
+void send_uart_message(char* message) {
+    uart_pr_send_string((u8*)message);
+    uart_pr_send_string((u8*)"\r\n");
+}
+
+void send_uart_number_32(u32 number) {
+    // Simple 32-bit number to string conversion
+    char buffer[11];
+    u8 i = 0, j;
+    if (number == 0) {
+        uart_pr_send_byte('0');
+        return;
+    }
+    while (number > 0) {
+        buffer[i++] = '0' + (number % 10);
+        number /= 10;
+    }
+    for (j = i; j > 0; j--) {
+        uart_pr_send_byte(buffer[j-1]);
+    }
+}
+
+static void report_line(char* label, u32 value) {
+    uart_pr_send_string((u8*)label);
+    send_uart_number_32(value);
+    uart_pr_send_string((u8*)"\r\n");
+}
+
+static u8 fast_count;
+
+// 10 ms task that wakes the event task every tenth run
+static void task_fast(void) {
+    if (++fast_count >= 10) {
+        fast_count = 0;
+        sched_signal(SCHED_TASK_DISPLAY);
+    }
+}
+
+// Event-only task standing in for a redraw
+static void task_event(void) {
+}
+
+// 250 ms task that busy-waits ~20 ms, to show up in the max execution time
+static void task_slow(void) {
+    delay_ms(0, 20);
+}
+
+// Once a second: dump per-task runs and worst-case run time, then restart
+static void task_report(void) {
+    send_uart_message("--- sched stats ---");
+    report_line("fast  runs/max ms: ", sched_stats[SCHED_TASK_KEYPAD].runs);
+    report_line("                   ", sched_stats[SCHED_TASK_KEYPAD].max_ms);
+    report_line("event runs/max ms: ", sched_stats[SCHED_TASK_DISPLAY].runs);
+    report_line("                   ", sched_stats[SCHED_TASK_DISPLAY].max_ms);
+    report_line("slow  runs/max ms: ", sched_stats[SCHED_TASK_PERSIST].runs);
+    report_line("                   ", sched_stats[SCHED_TASK_PERSIST].max_ms);
+    report_line("idle passes: ", sched_idle_passes);
+    report_line("total passes: ", sched_passes);
+    report_line("idle %: ", sched_idle_percent());
+    sched_stats_reset();
+}
+
+void main(void) {
+    // Minimal hardware initialization
+    hardware_init();
+    timer_init();
+    pwm_init(0, 0xc);
+    watchdog_init();
+    watchdog_reset();
+    watchdog_config();
+    pwm_pin_setup();
+    delay_ms(1, 0x2c);
+    uart_pr_init();
+    uart_bt_init();
+    lcd_init();
+
+    delay_ms(6, 232);
+
+    send_uart_message("=== SCHED TEST FIRMWARE ===");
+    send_uart_message("Expect ~100 fast, ~10 event, ~4 slow runs per report");
+    send_uart_message("and ~90% idle (the slow task busy-waits 80 ms/s)");
+
+    // Reuse the firmware's slot numbers so priorities match the real loop
+    sched_init();
+    sched_add(SCHED_TASK_KEYPAD, task_fast, 10);
+    sched_add(SCHED_TASK_DISPLAY, task_event, SCHED_EVENT_ONLY);
+    sched_add(SCHED_TASK_PERSIST, task_slow, 250);
+    sched_add(SCHED_TASK_SCAN, task_report, 1000);
+
+    // The scheduled tasks take over supervision from the boot client
+    watchdog_unregister(WATCHDOG_CLIENT_BOOT);
+
+    while (1) {
+        sched_run();
+    }
+}
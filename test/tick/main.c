@@ -0,0 +1,82 @@
+#include "H8.h"
+#include "delay.h"
+#include "watchdog.h"
+#include "hardware.h"
+#include "pwm.h"
+#include "uart.h"
+#include "lcd.h"
+#include "uart_test.h"
+#include "tick.h"
+
+// Simple UART message function implementation
+void send_uart_message(char* message) {
+    uart_pr_send_string((u8*)message);
+    uart_pr_send_string((u8*)"\r\n");
+}
+
+void send_uart_number_32(u32 number) {
+    // Simple 32-bit number to string conversion
+    char buffer[11];
+    u8 i = 0, j;
+    if (number == 0) {
+        uart_pr_send_byte('0');
+        return;
+    }
+    while (number > 0) {
+        buffer[i++] = '0' + (number % 10);
+        number /= 10;
+    }
+    for (j = i; j > 0; j--) {
+        uart_pr_send_byte(buffer[j-1]);
+    }
+}
+
+void main(void) {
+    u32 start;
+    u8 second_timer;
+    u8 oneshot_timer;
+
+    // Minimal hardware initialization
+    hardware_init();
+    timer_init();
+    pwm_init(0, 0xc);
+    watchdog_init();
+    watchdog_reset();
+    watchdog_config();
+    pwm_pin_setup();
+    delay_ms(1, 0x2c);
+    uart_pr_init();
+    uart_bt_init();
+    lcd_init();
+
+    delay_ms(6, 232);
+
+    send_uart_message("=== TICK TEST FIRMWARE ===");
+
+    // Calibration: a busy-loop second measured by the tick (should print ~1000)
+    send_uart_message("delay_ms(1000) measured in ticks:");
+    start = tick_now();
+    delay_ms(3, 232);
+    send_uart_number_32(tick_now() - start);
+    uart_pr_send_string((u8*)"\r\n");
+
+    // Periodic 1 s timer and a 5 s one-shot, polled without blocking
+    second_timer = tick_timer_start(1000, 1);
+    oneshot_timer = tick_timer_start(5000, 0);
+
+    // Setup is done: retire the boot client, the loop below feeds the dog by hand
+    watchdog_unregister(WATCHDOG_CLIENT_BOOT);
+
+    while (1) {
+        watchdog_reset();
+
+        if (tick_timer_expired(second_timer)) {
+            send_uart_message("Tick ms:");
+            send_uart_number_32(tick_now());
+            uart_pr_send_string((u8*)"\r\n");
+        }
+        if (tick_timer_expired(oneshot_timer)) {
+            send_uart_message("One-shot 5 s timer fired");
+        }
+    }
+}
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include "uart.h"
 #include "lcd.h"
 #include "uart_test.h"
+#include "tick.h"
+#include "event.h"
 
 // Simple UART message function implementation
 void send_uart_message(char* message) {
@@ -71,6 +73,7 @@ void main(void) {
     delay_ms(1, 0x2c);
     uart_pr_init();
     uart_bt_init();
+    uart_bt_rx_enable();
     lcd_init();
 
     delay_ms(6, 232);
@@ -83,14 +86,32 @@ void main(void) {
     send_uart_number_32(4294967295UL);
     send_uart_message("=== UART TESTS COMPLETE ===");
 
-    // Simple loop with periodic messages
-    u16 counter = 0;
+    // Echo Bluetooth input to the programming port: bytes arrive through
+    // uart_bt_isr and are announced on the event ring
+    send_uart_message("Echoing Bluetooth UART input...");
+    event_t event;
+    u8 byte;
+    u32 last_message = tick_now();
+    // Setup is done: retire the boot client, the loop below feeds the dog by hand
+    watchdog_unregister(WATCHDOG_CLIENT_BOOT);
+
     while (1) {
         watchdog_reset();
-        delay_ms(100, 0);
-        if (++counter >= 100) {
+        while (event_get(&event)) {
+            if (event.type == EVENT_UART_RX && event.arg == UART_PORT_BT) {
+                while (uart_bt_try_receive_byte(&byte)) {
+                    uart_pr_send_byte(byte);
+                }
+            }
+        }
+        if (tick_elapsed(last_message, 10000)) {
             send_uart_message("UART test running...");
-            counter = 0;
+            if (event_dropped || uart_rx_overflows) {
+                send_uart_message("Dropped events / RX bytes:");
+                send_uart_number(event_dropped);
+                send_uart_number(uart_rx_overflows);
+            }
+            last_message = tick_now();
         }
     }
 }
\ No newline at end of file